@@ -11,6 +11,8 @@
 */
 
 #include <benchmark/benchmark.h>
+#include <functional>
+#include <string>
 
 #include "../../e-antic/config.h"
 
@@ -32,6 +34,32 @@ static void ConstructTrivialField(State& state)
 BENCHMARK(ConstructTrivialField);
 
 
+static void ConstructField(State& state)
+{
+    const std::string minpoly = "x^" + std::to_string(state.range(0)) + " - 2";
+
+    for (auto _ : state)
+        DoNotOptimize(renf_class::make(minpoly, "x", "1 +/- 1", 64));
+}
+BENCHMARK(ConstructField)->Arg(2)->Arg(8)->Arg(32)->Arg(128);
+
+
+static void ConstructFieldFromCallback(State& state)
+{
+    const std::string minpoly = "x^" + std::to_string(state.range(0)) + " - 2";
+
+    // The ball "1 +/- 3" contains both real roots of x^n - 2 so the
+    // precision needs to be doubled three times before the root is isolated.
+    const std::function<std::string(slong)> emb = [](slong prec) {
+        return prec < 256 ? "1 +/- 3" : "1 +/- 1";
+    };
+
+    for (auto _ : state)
+        DoNotOptimize(renf_class::make(minpoly, "x", emb, 32));
+}
+BENCHMARK(ConstructFieldFromCallback)->Arg(2)->Arg(8)->Arg(32)->Arg(128);
+
+
 static void ConstructTrivialElement(State& state)
 {
     for (auto _ : state)
@@ -0,0 +1,70 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+#include "polynomials.hpp"
+
+using benchmark::DoNotOptimize;
+using benchmark::State;
+
+namespace eantic {
+namespace benchmark {
+
+namespace {
+
+// Evaluate a random irreducible polynomial of degree `state.range(0)` at a
+// ball close to 1 with `state.range(1)` bits of precision.
+void evaluate(State& state, void (*f)(arb_t, const fmpz*, slong, const arb_t, slong))
+{
+    fmpz_poly_t p;
+    arb_t a, y;
+    const slong prec = state.range(1);
+
+    fmpz_poly_init(p);
+    arb_init(a);
+    arb_init(y);
+
+    random(p, state.range(0));
+
+    // 1 + 1/3 as a ball with a radius that is tiny compared to prec
+    arb_set_ui(a, 1);
+    arb_div_ui(a, a, 3, prec);
+    arb_add_ui(a, a, 1, prec);
+
+    for (auto _ : state)
+    {
+        f(y, p->coeffs, p->length, a, prec);
+        DoNotOptimize(y);
+    }
+
+    arb_clear(a);
+    arb_clear(y);
+    fmpz_poly_clear(p);
+}
+
+}
+
+static void EvaluateHorner(State& state) { evaluate(state, _fmpz_poly_evaluate_arb_horner); }
+BENCHMARK(EvaluateHorner)->ArgsProduct({{16, 64, 256, 1024}, {64, 1024, 16384}});
+
+static void EvaluateRectangular(State& state) { evaluate(state, _fmpz_poly_evaluate_arb_rectangular); }
+BENCHMARK(EvaluateRectangular)->ArgsProduct({{16, 64, 256, 1024}, {64, 1024, 16384}});
+
+static void Evaluate(State& state) { evaluate(state, _fmpz_poly_evaluate_arb); }
+BENCHMARK(Evaluate)->ArgsProduct({{16, 64, 256, 1024}, {64, 1024, 16384}});
+
+}
+}
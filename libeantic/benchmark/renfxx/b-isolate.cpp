@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include <flint/fmpq.h>
+#include <flint/fmpz_vec.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+#include "polynomials.hpp"
+
+using benchmark::DoNotOptimize;
+using benchmark::State;
+
+namespace eantic {
+namespace benchmark {
+
+namespace {
+
+// Isolate the real roots of the polynomial of degree `state.range(0)` of the
+// given family with the method `state.range(1)`.
+// The size of the VCA subdivision tree and its largest coefficient are
+// reported as counters (for both methods) to tell whether a speedup comes
+// from exploring fewer nodes or from faster arithmetic.
+void isolate(State& state, void (*family)(fmpz_poly_t, slong))
+{
+    fmpz_poly_t p;
+    fmpz_poly_init(p);
+    family(p, state.range(0));
+
+    const slong len = fmpz_poly_length(p);
+    fmpq * exact = _fmpq_vec_init(len);
+    fmpz * c = _fmpz_vec_init(len);
+    std::vector<slong> k(static_cast<size_t>(len));
+
+    const int method = fmpz_poly_isolate_real_roots_get_method();
+    fmpz_poly_isolate_real_roots_set_method(static_cast<int>(state.range(1)));
+
+    for (auto _ : state)
+    {
+        slong n_exact, n_interval;
+        fmpz_poly_isolate_real_roots(exact, &n_exact, c, k.data(), &n_interval, p);
+        DoNotOptimize(n_interval);
+    }
+
+    fmpz_poly_isolate_real_roots_set_method(method);
+
+    const IsolationTree tree = isolation_tree(p);
+    state.counters["nodes"] = static_cast<double>(tree.nodes);
+    state.counters["bits"] = static_cast<double>(tree.bits);
+
+    _fmpq_vec_clear(exact, len);
+    _fmpz_vec_clear(c, len);
+    fmpz_poly_clear(p);
+}
+
+}
+
+#define ISOLATE_BENCHMARK(name, family) \
+    static void name(State& state) { isolate(state, family); } \
+    BENCHMARK(name)->ArgsProduct({degrees(), {FMPZ_POLY_ISOLATE_REAL_ROOTS_VCA, FMPZ_POLY_ISOLATE_REAL_ROOTS_VAS}});
+
+ISOLATE_BENCHMARK(IsolateMignotte, mignotte)
+ISOLATE_BENCHMARK(IsolateChebyshev, chebyshev)
+ISOLATE_BENCHMARK(IsolateWilkinson, wilkinson)
+ISOLATE_BENCHMARK(IsolateLaguerre, laguerre)
+ISOLATE_BENCHMARK(IsolateRandom, random)
+
+}
+}
@@ -0,0 +1,140 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_matrix.hpp"
+
+#include "number_fields.hpp"
+
+using benchmark::DoNotOptimize;
+using benchmark::State;
+
+namespace eantic {
+namespace benchmark {
+
+namespace {
+
+using naive_matrix = std::vector<std::vector<renf_elem_class>>;
+
+// Return a pseudo-random dense matrix with small entries over K.
+naive_matrix make_matrix(const renf_class& K, size_t n, unsigned int seed)
+{
+    std::minstd_rand rand(seed + 1);
+
+    naive_matrix A(n, std::vector<renf_elem_class>(n, K.zero()));
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++)
+            A[i][j] = static_cast<long>(rand() % 11) - 5 + (static_cast<long>(rand() % 5) - 2) * K.gen();
+    return A;
+}
+
+naive_matrix mul(const naive_matrix& A, const naive_matrix& B)
+{
+    naive_matrix C(A.size(), std::vector<renf_elem_class>(B[0].size(), A[0][0].parent().zero()));
+    for (size_t i = 0; i < A.size(); i++)
+        for (size_t j = 0; j < B[0].size(); j++)
+            for (size_t k = 0; k < B.size(); k++)
+                C[i][j] += A[i][k] * B[k][j];
+    return C;
+}
+
+// Gaussian elimination as it is typically implemented on top of renf_elem_class.
+renf_elem_class det(naive_matrix A)
+{
+    const size_t n = A.size();
+    renf_elem_class det = A[0][0].parent().one();
+
+    for (size_t c = 0; c < n; c++)
+    {
+        size_t r = c;
+        while (r < n && A[r][c] == 0)
+            r++;
+        if (r == n)
+            return A[0][0].parent().zero();
+        if (r != c)
+        {
+            std::swap(A[r], A[c]);
+            det = -det;
+        }
+
+        det *= A[c][c];
+        for (size_t i = c + 1; i < n; i++)
+        {
+            const renf_elem_class f = A[i][c] / A[c][c];
+            for (size_t j = c; j < n; j++)
+                A[i][j] -= f * A[c][j];
+        }
+    }
+
+    return det;
+}
+
+}
+
+static void NaiveMatrixMultiplication(State& state)
+{
+    const auto K = make_number_field(state.range(0));
+    const auto A = make_matrix(*K, state.range(1), 0);
+    const auto B = make_matrix(*K, state.range(1), 1);
+
+    for (auto _ : state)
+        DoNotOptimize(mul(A, B));
+}
+BENCHMARK(NaiveMatrixMultiplication)->Args({2, 10})->Args({2, 100})->Args({4, 100})->Args({8, 100})->Args({2, 500})->Unit(::benchmark::kMillisecond);
+
+static void MatrixMultiplication(State& state)
+{
+    const auto K = make_number_field(state.range(0));
+    const auto A = renf_matrix(*K, make_matrix(*K, state.range(1), 0));
+    const auto B = renf_matrix(*K, make_matrix(*K, state.range(1), 1));
+
+    for (auto _ : state)
+        DoNotOptimize(A * B);
+}
+BENCHMARK(MatrixMultiplication)->Args({2, 10})->Args({2, 100})->Args({4, 100})->Args({8, 100})->Args({2, 500})->Unit(::benchmark::kMillisecond);
+
+static void NaiveDeterminant(State& state)
+{
+    const auto K = make_number_field(state.range(0));
+    const auto A = make_matrix(*K, state.range(1), 0);
+
+    for (auto _ : state)
+        DoNotOptimize(det(A));
+}
+BENCHMARK(NaiveDeterminant)->Args({2, 10})->Args({2, 50})->Args({3, 50})->Args({6, 20})->Args({8, 20})->Unit(::benchmark::kMillisecond);
+
+static void Determinant(State& state)
+{
+    const auto K = make_number_field(state.range(0));
+    const auto A = renf_matrix(*K, make_matrix(*K, state.range(1), 0));
+
+    for (auto _ : state)
+        DoNotOptimize(A.det());
+}
+BENCHMARK(Determinant)->Args({2, 10})->Args({2, 50})->Args({3, 50})->Args({6, 20})->Args({8, 20})->Unit(::benchmark::kMillisecond);
+
+static void Rank(State& state)
+{
+    const auto K = make_number_field(state.range(0));
+    const auto A = renf_matrix(*K, make_matrix(*K, state.range(1), 0));
+
+    for (auto _ : state)
+        DoNotOptimize(A.rank());
+}
+BENCHMARK(Rank)->Args({2, 50})->Args({8, 20})->Unit(::benchmark::kMillisecond);
+
+}
+}
@@ -0,0 +1,211 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include <flint/fmpq.h>
+#include <flint/fmpq_poly.h>
+#include <flint/fmpz_vec.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+#include "../../e-antic/fmpq_poly_extra.h"
+#include "../../e-antic/renf.h"
+
+#include "polynomials.hpp"
+
+using benchmark::DoNotOptimize;
+using benchmark::State;
+
+namespace eantic {
+namespace benchmark {
+
+namespace {
+
+// The real roots of a polynomial as isolating balls.
+struct Roots
+{
+    explicit Roots(fmpz_poly_t p)
+    {
+        const slong len = fmpz_poly_length(p);
+        fmpq* exact = _fmpq_vec_init(len);
+        fmpz* c = _fmpz_vec_init(len);
+        std::vector<slong> k(static_cast<size_t>(len));
+        slong n_exact, n_interval;
+
+        fmpz_poly_isolate_real_roots(exact, &n_exact, c, k.data(), &n_interval, p);
+
+        balls.resize(static_cast<size_t>(n_interval));
+        for (slong i = 0; i < n_interval; i++)
+        {
+            // the ball around (c + 1/2) 2^k with radius 2^(k - 1)
+            arb_struct* a = &balls[static_cast<size_t>(i)];
+            arb_init(a);
+            arb_set_fmpz(a, c + i);
+            arb_mul_2exp_si(a, a, 1);
+            arb_add_si(a, a, 1, 64);
+            mag_one(arb_radref(a));
+            arb_mul_2exp_si(a, a, k[static_cast<size_t>(i)] - 1);
+        }
+
+        _fmpq_vec_clear(exact, len);
+        _fmpz_vec_clear(c, len);
+    }
+
+    Roots(const Roots&) = delete;
+
+    ~Roots()
+    {
+        for (auto& a : balls)
+            arb_clear(&a);
+    }
+
+    std::vector<arb_struct> balls;
+};
+
+// Count the real roots of the polynomial of degree `state.range(0)` of the
+// given family with VCA.
+void num_real_roots_vca(State& state, void (*family)(fmpz_poly_t, slong))
+{
+    fmpz_poly_t p;
+    fmpz_poly_init(p);
+    family(p, state.range(0));
+
+    for (auto _ : state)
+        DoNotOptimize(fmpz_poly_num_real_roots_vca(p));
+
+    fmpz_poly_clear(p);
+}
+
+// Count the real roots of the polynomial of degree `state.range(0)` of the
+// given family with a Sturm sequence, including the construction of the
+// sequence.
+void num_real_roots_sturm(State& state, void (*family)(fmpz_poly_t, slong))
+{
+    fmpz_poly_t p;
+    fmpz_poly_init(p);
+    family(p, state.range(0));
+
+    for (auto _ : state)
+    {
+        fmpz_poly_sturm_t S;
+        fmpz_poly_sturm_init(S, p);
+        DoNotOptimize(fmpz_poly_sturm_num_real_roots(S));
+        fmpz_poly_sturm_clear(S);
+    }
+
+    fmpz_poly_clear(p);
+}
+
+// Check that the isolating balls of the polynomial of degree
+// `state.range(0)` of the given family contain a unique root, once with
+// fmpq_poly_check_unique_real_root and once with a shared Sturm sequence.
+void check_unique_real_root(State& state, void (*family)(fmpz_poly_t, slong), bool sturm)
+{
+    fmpz_poly_t p;
+    fmpq_poly_t q;
+    fmpz_poly_init(p);
+    fmpq_poly_init(q);
+    family(p, state.range(0));
+    fmpq_poly_set_fmpz_poly(q, p);
+
+    const Roots roots(p);
+
+    if (sturm)
+    {
+        fmpz_poly_sturm_t S;
+        fmpz_poly_sturm_init(S, p);
+        for (auto _ : state)
+            for (const auto& a : roots.balls)
+                DoNotOptimize(fmpz_poly_sturm_num_roots_arb(S, &a, 64));
+        fmpz_poly_sturm_clear(S);
+    }
+    else
+    {
+        for (auto _ : state)
+            for (const auto& a : roots.balls)
+                DoNotOptimize(fmpq_poly_check_unique_real_root(q, &a, 64));
+    }
+
+    state.counters["roots"] = static_cast<double>(roots.balls.size());
+
+    fmpq_poly_clear(q);
+    fmpz_poly_clear(p);
+}
+
+// Refine the embedding of the number field defined by the largest root of
+// the irreducible polynomial of degree `state.range(0)` of the given family
+// from its isolating interval to `state.range(1)` bits.
+void refine_embedding(State& state, void (*family)(fmpz_poly_t, slong))
+{
+    fmpz_poly_t p;
+    fmpq_poly_t q;
+    fmpz_poly_init(p);
+    fmpq_poly_init(q);
+    family(p, state.range(0));
+    fmpq_poly_set_fmpz_poly(q, p);
+
+    const Roots roots(p);
+
+    if (roots.balls.empty())
+    {
+        state.SkipWithError("polynomial has no real roots");
+    }
+    else
+    {
+        arb_t a;
+        arb_init(a);
+        arb_set(a, &roots.balls.back());
+
+        for (auto _ : state)
+        {
+            renf_t nf;
+            _renf_init(nf, q, a, 64);
+            renf_refine_embedding(nf, state.range(1));
+            renf_clear(nf);
+        }
+
+        arb_clear(a);
+    }
+
+    fmpq_poly_clear(q);
+    fmpz_poly_clear(p);
+}
+
+}
+
+#define ROOTS_BENCHMARK(name, family) \
+    static void NumRealRootsVCA##name(State& state) { num_real_roots_vca(state, family); } \
+    BENCHMARK(NumRealRootsVCA##name)->ArgsProduct({degrees()}); \
+    static void NumRealRootsSturm##name(State& state) { num_real_roots_sturm(state, family); } \
+    BENCHMARK(NumRealRootsSturm##name)->ArgsProduct({degrees()}); \
+    static void CheckUniqueRealRoot##name(State& state) { check_unique_real_root(state, family, false); } \
+    BENCHMARK(CheckUniqueRealRoot##name)->ArgsProduct({degrees()}); \
+    static void CheckUniqueRealRootSturm##name(State& state) { check_unique_real_root(state, family, true); } \
+    BENCHMARK(CheckUniqueRealRootSturm##name)->ArgsProduct({degrees()});
+
+ROOTS_BENCHMARK(Mignotte, mignotte)
+ROOTS_BENCHMARK(Chebyshev, chebyshev)
+ROOTS_BENCHMARK(Wilkinson, wilkinson)
+ROOTS_BENCHMARK(Laguerre, laguerre)
+ROOTS_BENCHMARK(Random, random)
+
+// The embedding can only be refined for irreducible polynomials.
+static void RefineEmbeddingLaguerre(State& state) { refine_embedding(state, laguerre); }
+BENCHMARK(RefineEmbeddingLaguerre)->ArgsProduct({degrees(), {64, 1024, 16384}});
+
+static void RefineEmbeddingRandom(State& state) { refine_embedding(state, random); }
+BENCHMARK(RefineEmbeddingRandom)->ArgsProduct({degrees(), {64, 1024, 16384}});
+
+}
+}
@@ -0,0 +1,100 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+#include "../../e-antic/renf_elem_class.hpp"
+
+#include "number_fields.hpp"
+
+using benchmark::DoNotOptimize;
+using benchmark::State;
+
+namespace eantic {
+namespace benchmark {
+
+namespace {
+
+// Return `count` distinct elements of the field `K`.
+std::vector<renf_elem_class> make_elements(const renf_class& K, size_t count)
+{
+    std::vector<renf_elem_class> elements;
+    for (size_t i = 0; i < count; i++)
+    {
+        renf_elem_class x = K.zero();
+        for (slong k = K.degree() - 1; k >= 0; k--)
+            x = x * K.gen() + static_cast<long>((i * static_cast<size_t>(k + 3)) % 101) - 50;
+        elements.push_back(x / static_cast<long>(1 + i % 5));
+    }
+    return elements;
+}
+
+}
+
+// Evaluate many elements one by one with arb.
+static void EvaluateElements(State& state)
+{
+    const auto K = make_number_field(state.range(0));
+    auto elements = make_elements(*K, state.range(1));
+
+    for (auto _ : state)
+        for (auto& x : elements)
+            renf_elem_set_evaluation(x.renf_elem_t(), K->renf_t(), K->renf_t()->prec);
+}
+BENCHMARK(EvaluateElements)->Args({2, 1024})->Args({4, 1024})->Args({4, 65536});
+
+// Evaluate the same elements with the batched double evaluation.
+static void EvaluateSoa(State& state)
+{
+    const auto K = make_number_field(state.range(0));
+    const auto elements = make_elements(*K, state.range(1));
+
+    renf_soa_t v;
+    renf_soa_init(v, K->renf_t());
+    for (const auto& x : elements)
+        renf_soa_push(v, x.renf_elem_t(), K->renf_t());
+
+    for (auto _ : state)
+    {
+        renf_soa_set_evaluation(v, K->renf_t());
+        DoNotOptimize(v->mid[0]);
+    }
+
+    renf_soa_clear(v);
+}
+BENCHMARK(EvaluateSoa)->Args({2, 1024})->Args({4, 1024})->Args({4, 65536});
+
+// Sort elements by going through their enclosures first.
+static void SortSoa(State& state)
+{
+    const auto K = make_number_field(state.range(0));
+    const auto elements = make_elements(*K, state.range(1));
+
+    renf_soa_t v;
+    renf_soa_init(v, K->renf_t());
+    for (const auto& x : elements)
+        renf_soa_push(v, x.renf_elem_t(), K->renf_t());
+
+    std::vector<slong> perm(elements.size());
+
+    for (auto _ : state)
+        renf_soa_sort(perm.data(), v, K->renf_t());
+
+    renf_soa_clear(v);
+}
+BENCHMARK(SortSoa)->Args({2, 1024})->Args({4, 1024})->Args({4, 65536});
+
+}
+}
@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_acc.h"
+#include "../../e-antic/renf_elem_class.hpp"
+
+#include "number_fields.hpp"
+
+using benchmark::DoNotOptimize;
+using benchmark::State;
+
+namespace eantic {
+namespace benchmark {
+
+namespace {
+
+// Return `count` elements of the field `K` with a few distinct denominators.
+std::vector<renf_elem_class> make_terms(const renf_class& K, size_t count)
+{
+    std::vector<renf_elem_class> terms;
+    for (size_t i = 0; i < count; i++)
+    {
+        renf_elem_class x = K.zero();
+        for (slong k = K.degree() - 1; k >= 0; k--)
+            x = x * K.gen() + static_cast<long>((i * static_cast<size_t>(k + 7)) % 97) - 48;
+        terms.push_back(x / static_cast<long>(1 + i % 6));
+    }
+    return terms;
+}
+
+}
+
+// Sum elements with renf_elem_add which canonicalises after every term.
+static void SumElements(State& state)
+{
+    const auto K = make_number_field(state.range(0));
+    const auto terms = make_terms(*K, state.range(1));
+
+    for (auto _ : state)
+    {
+        renf_elem_class sum = K->zero();
+        for (const auto& x : terms)
+            renf_elem_add(sum.renf_elem_t(), sum.renf_elem_t(), x.renf_elem_t(), K->renf_t());
+        DoNotOptimize(sum);
+    }
+}
+BENCHMARK(SumElements)->Args({2, 4096})->Args({4, 4096})->Args({8, 4096});
+
+// Sum the same elements with an accumulator that canonicalises only once.
+static void SumAccumulator(State& state)
+{
+    const auto K = make_number_field(state.range(0));
+    const auto terms = make_terms(*K, state.range(1));
+
+    renf_acc_t acc;
+    renf_acc_init(acc, K->renf_t());
+
+    for (auto _ : state)
+    {
+        renf_elem_class sum = K->zero();
+        renf_acc_zero(acc);
+        for (const auto& x : terms)
+            renf_acc_add(acc, x.renf_elem_t(), K->renf_t());
+        renf_acc_finish(sum.renf_elem_t(), acc, K->renf_t());
+        DoNotOptimize(sum);
+    }
+
+    renf_acc_clear(acc);
+}
+BENCHMARK(SumAccumulator)->Args({2, 4096})->Args({4, 4096})->Args({8, 4096});
+
+}
+}
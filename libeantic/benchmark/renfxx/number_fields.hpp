@@ -25,8 +25,14 @@ inline auto make_number_field(size_t degree)
         return boost::intrusive_ptr<const renf_class>(&renf_class::make());
     if (degree == 2)
         return renf_class::make("x^2 - 2", "x", "1 +/- 1", 64);
+    if (degree == 3)
+        return renf_class::make("x^3 - 2", "x", "1 +/- 1", 64);
     if (degree == 4)
         return renf_class::make("x^4 - 2", "x", "1 +/- 1", 64);
+    if (degree == 6)
+        return renf_class::make("x^6 - 2", "x", "1 +/- 1", 64);
+    if (degree == 8)
+        return renf_class::make("x^8 - 2", "x", "1 +/- 1", 64);
 
     throw std::logic_error("not implemented: field of this degree");
 }
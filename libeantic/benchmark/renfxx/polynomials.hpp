@@ -0,0 +1,183 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef E_ANTIC_BENCHMARK_RENFXX_POLYNOMIALS_HPP
+#define E_ANTIC_BENCHMARK_RENFXX_POLYNOMIALS_HPP
+
+#include <algorithm>
+#include <cstdlib>
+#include <initializer_list>
+#include <vector>
+
+#include <flint/fmpz_poly.h>
+#include <flint/fmpz_vec.h>
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+namespace eantic {
+namespace benchmark {
+
+/// Set `p` to the Mignotte polynomial x^n - 2(10x - 1)^2 which has two roots
+/// that are very close to each other.
+inline void mignotte(fmpz_poly_t p, slong n)
+{
+    fmpz_poly_zero(p);
+    fmpz_poly_set_coeff_si(p, n, 1);
+    fmpz_poly_set_coeff_si(p, 2, -200);
+    fmpz_poly_set_coeff_si(p, 1, 40);
+    fmpz_poly_set_coeff_si(p, 0, -2);
+}
+
+/// Set `p` to the Chebyshev polynomial of degree n, all of whose roots are
+/// real and clustered towards the boundary of [-1, 1].
+inline void chebyshev(fmpz_poly_t p, slong n)
+{
+    fmpz_poly_chebyshev_t(p, static_cast<ulong>(n));
+}
+
+/// Set `p` to the Wilkinson polynomial (x - 1)(x - 2)…(x - n).
+inline void wilkinson(fmpz_poly_t p, slong n)
+{
+    fmpz_poly_t q;
+    fmpz_poly_init(q);
+    fmpz_poly_one(p);
+    fmpz_poly_set_coeff_si(q, 1, 1);
+    for (slong i = 1; i <= n; i++)
+    {
+        fmpz_poly_set_coeff_si(q, 0, -i);
+        fmpz_poly_mul(p, p, q);
+    }
+    fmpz_poly_clear(q);
+}
+
+/// Set `p` to n! times the Laguerre polynomial of degree n. It is irreducible
+/// and all its roots are real and positive with large coefficients.
+inline void laguerre(fmpz_poly_t p, slong n)
+{
+    // The coefficient of x^k is (-1)^k binomial(n, k) n! / k!.
+    fmpz_t c;
+    fmpz_init(c);
+    fmpz_poly_zero(p);
+    fmpz_one(c);
+    for (slong k = n; k >= 0; k--)
+    {
+        // c = binomial(n, k) n! / k! computed from the value for k + 1
+        if (k < n)
+        {
+            fmpz_mul_ui(c, c, static_cast<ulong>(k + 1));
+            fmpz_mul_ui(c, c, static_cast<ulong>(k + 1));
+            fmpz_divexact_ui(c, c, static_cast<ulong>(n - k));
+        }
+        fmpz_poly_set_coeff_fmpz(p, k, c);
+        if (k % 2)
+            fmpz_neg(p->coeffs + k, p->coeffs + k);
+    }
+    fmpz_clear(c);
+}
+
+/// Set `p` to a random irreducible polynomial of degree n.
+inline void random(fmpz_poly_t p, slong n)
+{
+    flint_rand_t state;
+    flint_randinit(state);
+    fmpz_poly_randtest_irreducible(p, state, n + 1, 64);
+    flint_randclear(state);
+}
+
+/// Statistics of the subdivision tree that VCA explores to isolate the
+/// real roots of a polynomial.
+struct IsolationTree
+{
+    /// The number of nodes, i.e., of Descartes tests.
+    size_t nodes = 0;
+
+    /// The largest bit size of a coefficient of the polynomials in the tree.
+    slong bits = 0;
+};
+
+namespace detail {
+
+// Walk the subdivision tree of the interval (0, 1) for (p, len).
+inline void isolation_tree(IsolationTree& tree, const fmpz * p, slong len)
+{
+    while (len > 1 && fmpz_is_zero(p))
+    {
+        p++;
+        len--;
+    }
+
+    tree.nodes++;
+    tree.bits = std::max(tree.bits, std::abs(_fmpz_vec_max_bits(p, len)));
+
+    if (len <= 1)
+        return;
+
+    if (_fmpz_poly_descartes_bound_0_1(const_cast<fmpz*>(p), len, 1) <= 1)
+        return;
+
+    fmpz_t one;
+    fmpz_init_set_ui(one, 1);
+    fmpz* q = _fmpz_vec_init(len);
+
+    _fmpz_vec_set(q, p, len);
+    _fmpz_poly_scale_2exp(q, len, -1);
+    isolation_tree(tree, q, len);
+
+    _fmpz_poly_taylor_shift(q, one, len);
+    isolation_tree(tree, q, len);
+
+    _fmpz_vec_clear(q, len);
+    fmpz_clear(one);
+}
+
+}
+
+/// Return the statistics of the subdivision tree of VCA for the squarefree
+/// polynomial `pol`. Like fmpz_poly_isolate_real_roots, both half-lines are
+/// scaled into (0, 1) with a root bound first.
+inline IsolationTree isolation_tree(const fmpz_poly_t pol)
+{
+    IsolationTree tree;
+
+    const slong len = fmpz_poly_length(pol);
+    fmpz* p = _fmpz_vec_init(len);
+
+    for (int sign : {1, -1})
+    {
+        _fmpz_vec_set(p, pol->coeffs, len);
+        if (sign == -1)
+            for (slong i = 1; i < len; i += 2)
+                fmpz_neg(p + i, p + i);
+
+        const slong k = _fmpz_poly_positive_root_upper_bound_2exp(p, len);
+        if (k == WORD_MIN)
+            continue;
+        _fmpz_poly_scale_2exp(p, len, k);
+
+        detail::isolation_tree(tree, p, len);
+    }
+
+    _fmpz_vec_clear(p, len);
+
+    return tree;
+}
+
+/// The degrees of the polynomials in the root isolation benchmarks.
+inline const std::vector<int64_t>& degrees()
+{
+    static const std::vector<int64_t> degrees = {8, 32, 128, 512};
+    return degrees;
+}
+
+}
+}
+
+#endif
@@ -24,6 +24,7 @@
 
 #include "renf_class.hpp"
 #include "renf_elem_class.hpp"
+#include "renf_trace.h"
 
 namespace eantic {
 template <class Archive>
@@ -42,6 +43,8 @@ void save(Archive & archive, const boost::intrusive_ptr<const renf_class> & self
         // This is the first time cereal sees this renf_class, so we actually
         // store it. Future copies only need the id to resolve to a pointer to
         // the same renf_class.
+        const ulong start = _renf_trace_start();
+
         auto construction = self->construction();
 
         archive(
@@ -49,6 +52,8 @@ void save(Archive & archive, const boost::intrusive_ptr<const renf_class> & self
             cereal::make_nvp("embedding", std::get<2>(construction)),
             cereal::make_nvp("minpoly", std::get<0>(construction)),
             cereal::make_nvp("precision", std::get<3>(construction)));
+
+        _renf_trace(RENF_TRACE_SERIALIZATION, self->renf_t(), self->renf_t()->prec, std::get<3>(construction), start);
     }
 }
 
@@ -95,6 +100,8 @@ void load(Archive & archive, boost::intrusive_ptr<const renf_class> & self)
 
     if ( id & static_cast<unsigned int>(cereal::detail::msb_32bit) )
     {
+        const ulong start = _renf_trace_start();
+
         std::string name, emb, pol;
         slong prec;
 
@@ -103,6 +110,8 @@ void load(Archive & archive, boost::intrusive_ptr<const renf_class> & self)
         // Restore this embedded number field.
         self = renf_class::make(pol, name, emb, prec);
 
+        _renf_trace(RENF_TRACE_DESERIALIZATION, self->renf_t(), prec, self->renf_t()->prec, start);
+
         // We store a reference to this field with cereal's shared pointer machinery.
         // This shared pointer will be kept alive by cereal until the
         // deserialization of the whole file is complete. So we new an
@@ -18,6 +18,13 @@
 
 #include "renf_elem.h"
 #include "renf.h"
+#include "renf_acc.h"
+#include "renf_cache.h"
+#include "renf_hom.h"
+#include "renf_mat.h"
+#include "renf_soa.h"
+#include "renf_trace.h"
+#include "renf_vec.h"
 
 #include "fmpz_poly_extra.h"
 #include "fmpq_poly_extra.h"
@@ -19,5 +19,7 @@
 
 #include "renf_class.hpp"
 #include "renf_elem_class.hpp"
+#include "renf_elem_intern_pool.hpp"
+#include "renf_matrix.hpp"
 
 #endif
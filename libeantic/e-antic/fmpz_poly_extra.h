@@ -67,6 +67,13 @@ LIBEANTIC_API slong fmpz_poly_num_real_roots_upper_bound(fmpz_poly_t pol);
 /// returned.
 LIBEANTIC_API slong _fmpz_poly_descartes_bound_0_1(fmpz * p, slong len, slong bound);
 
+/// Return the same bound as [_fmpz_poly_descartes_bound_0_1]() but use the
+/// `len` initialized entries of `scratch` as temporary storage instead of
+/// allocating memory. When the coefficients of the Taylor shift of `(p, len)`
+/// are guaranteed to fit into a word, the computation avoids fmpz arithmetic
+/// altogether.
+LIBEANTIC_API slong _fmpz_poly_descartes_bound_0_1_scratch(const fmpz * p, slong len, slong bound, fmpz * scratch);
+
 LIBEANTIC_API slong _fmpz_poly_descartes_bound(fmpz * p, slong len, slong bound);
 
 /// Isolate the real roots of `(pol, len)` contained in the
@@ -80,6 +87,66 @@ LIBEANTIC_API slong _fmpz_poly_descartes_bound(fmpz * p, slong len, slong bound)
 /// \f$(c 2^k, (c + 1) 2^k)\f$.
 LIBEANTIC_API void _fmpz_poly_isolate_real_roots_0_1_vca(fmpq * exact_roots, slong * n_exact_roots, fmpz * c_array, slong * k_array, slong * n_intervals, fmpz * pol, slong len);
 
+/// Isolate the real roots in \f$(0, 1)\f$ of the `num` polynomials
+/// `(pols[i], lens[i])` using up to `thread_limit` threads. The roots of the
+/// `i`-th polynomial are written to `exact_roots[i]`, `c_array[i]`, and
+/// `k_array[i]`, and counted in `n_exact_roots[i]` and `n_intervals[i]`
+/// exactly as [_fmpz_poly_isolate_real_roots_0_1_vca]() would. A polynomial
+/// of length zero is skipped.
+///
+/// The upper levels of the subdivision trees are expanded until there are
+/// enough subtrees to distribute among the threads. The subtrees are then
+/// explored concurrently and the results are combined in the same order in
+/// which the sequential algorithm produces them.
+LIBEANTIC_API void _fmpz_poly_isolate_real_roots_0_1_vca_threaded(fmpq ** exact_roots, slong * n_exact_roots, fmpz ** c_array, slong ** k_array, slong * n_intervals, fmpz * const * pols, const slong * lens, slong num, slong thread_limit);
+
+/// Isolate the real roots of `(pol, len)` contained in the interval
+/// \f$(0, 1)\f$ with the VCA method but with ball approximations of the
+/// coefficients instead of exact arithmetic. The output is the same as for
+/// [_fmpz_poly_isolate_real_roots_0_1_vca]().
+///
+/// The polynomials of the subdivision are computed with arb at a working
+/// precision of `prec` bits. Whenever the sign of a coefficient that decides
+/// the outcome of Descartes' rule cannot be certified, the polynomial is
+/// recomputed exactly and the working precision for that part of the
+/// subdivision is doubled. This is much faster than exact arithmetic for
+/// polynomials of large degree with large coefficients.
+LIBEANTIC_API void _fmpz_poly_isolate_real_roots_0_1_arb(fmpq * exact_roots, slong * n_exact_roots, fmpz * c_array, slong * k_array, slong * n_intervals, fmpz * pol, slong len, slong prec);
+
+/// Isolate the real roots of `(pol, len)` contained in the interval
+/// \f$(0, 1)\f$ with the continued fraction method of Vincent, Akritas, and
+/// Strzeboński. The output has the same format as for
+/// [_fmpz_poly_isolate_real_roots_0_1_vca](), i.e., dyadic exact roots and
+/// dyadic intervals that contain exactly one root each, in increasing order.
+/// Every dyadic root is reported as an exact root, also when `c_array` and
+/// `k_array` are `NULL`. (Bisection, i.e., VCA, only finds the dyadic roots
+/// exactly that happen to be endpoints of its subdivision.)
+///
+/// Instead of bisecting, this method jumps over intervals that contain no
+/// roots using lower bounds for the positive roots. It is usually much faster
+/// than VCA for polynomials with clustered roots or a large spread between
+/// the roots.
+LIBEANTIC_API void _fmpz_poly_isolate_real_roots_0_1_vas(fmpq * exact_roots, slong * n_exact_roots, fmpz * c_array, slong * k_array, slong * n_intervals, fmpz * pol, slong len);
+
+/// Isolate roots by bisection with the method of Vincent, Collins, and
+/// Akritas, see [_fmpz_poly_isolate_real_roots_0_1_vca]().
+#define FMPZ_POLY_ISOLATE_REAL_ROOTS_VCA 0
+
+/// Isolate roots with continued fractions with the method of Vincent,
+/// Akritas, and Strzeboński, see [_fmpz_poly_isolate_real_roots_0_1_vas]().
+#define FMPZ_POLY_ISOLATE_REAL_ROOTS_VAS 1
+
+/// Set the method that [fmpz_poly_isolate_real_roots]() uses to isolate
+/// roots, i.e., either `FMPZ_POLY_ISOLATE_REAL_ROOTS_VCA` (the default) or
+/// `FMPZ_POLY_ISOLATE_REAL_ROOTS_VAS`.
+/// The setting is global and should not be changed while roots are being
+/// isolated in another thread.
+LIBEANTIC_API void fmpz_poly_isolate_real_roots_set_method(int method);
+
+/// Return the method that [fmpz_poly_isolate_real_roots]() uses to isolate
+/// roots.
+LIBEANTIC_API int fmpz_poly_isolate_real_roots_get_method(void);
+
 /// Isolate the real roots of `pol`. The array
 /// `exact_roots` will be set by the exact dyadic roots found
 /// by the algorithm and `n_exact_roots` updated accordingly.
@@ -88,17 +155,62 @@ LIBEANTIC_API void _fmpz_poly_isolate_real_roots_0_1_vca(fmpq * exact_roots, slo
 /// `n_interval` is updated accordingly. A data
 /// `c = c_array + i` and `k = k_array[i]` represents the
 /// open interval \f$(c 2^k, (c + 1) 2^k)\f$.
+///
+/// The roots are isolated with the method selected by
+/// [fmpz_poly_isolate_real_roots_set_method](). For long polynomials, the
+/// VCA method uses as many threads as are configured with
+/// `flint_set_num_threads`. Without threads, polynomials of large degree
+/// are handled with [_fmpz_poly_isolate_real_roots_0_1_arb](). Since that
+/// variant takes the same decisions as exact VCA, the result does not depend
+/// on the number of threads.
 LIBEANTIC_API void fmpz_poly_isolate_real_roots(fmpq * exact_roots, slong * n_exact, fmpz * c_array, slong * k_array, slong * n_interval, fmpz_poly_t pol);
+
+/// Isolate the real roots of `pol` as [fmpz_poly_isolate_real_roots]() does
+/// but with up to `thread_limit` threads. The roots on the negative and on
+/// the positive half-line are isolated concurrently. The VAS method does not
+/// use threads.
+LIBEANTIC_API void fmpz_poly_isolate_real_roots_threaded(fmpq * exact_roots, slong * n_exact, fmpz * c_array, slong * k_array, slong * n_interval, fmpz_poly_t pol, slong thread_limit);
 ///@}
 
 //// \name Root refinement
 ///@{
+/// Set `res` to the result of a Newton step for `(pol, len)` from the ball
+/// `a` and return whether `res` is strictly contained in `a`.
+/// The derivative `der` is not used anymore since the derivative is computed
+/// along with the value of `pol`, see [_fmpz_poly_newton_evaluate_arb]().
 LIBEANTIC_API int _fmpz_poly_newton_step_arb(arb_t res, const fmpz * pol, const fmpz * der, slong len, arb_t a, slong prec);
 
+/// Perform a Newton step as [_fmpz_poly_newton_step_arb]() and, if `cond` is
+/// not `NULL`, set `cond` to an upper bound of the relative condition number
+/// of `(pol, len)` on `a`, i.e., of \f$\sum |p_i| |x|^i\f$.
+LIBEANTIC_API int _fmpz_poly_newton_step_cond_arb(arb_t res, mag_t cond, const fmpz * pol, slong len, const arb_t a, slong prec);
+
+/// Set `y` to the value of `(pol, len)` at the midpoint of `a`, `dy` to an
+/// enclosure of its derivative on `a` and, if `cond` is not `NULL`, `cond` to
+/// an upper bound of \f$\sum |p_i| |x|^i\f$ on `a`, all with a single pass
+/// over the coefficients. The derivative is enclosed by bounding the second
+/// derivative with the absolute values of the coefficients, so this is
+/// most accurate for balls `a` that are small compared to the distance to
+/// the other roots. `y` and `dy` must not be aliased with `a`.
+LIBEANTIC_API void _fmpz_poly_newton_evaluate_arb(arb_t y, arb_t dy, mag_t cond, const fmpz * pol, slong len, const arb_t a, slong prec);
+
 LIBEANTIC_API int _fmpz_poly_bisection_step_arb(arb_t res, fmpz * pol, slong len, arb_t a, slong prec);
 
+/// Perform a Newton step as [_fmpz_poly_newton_step_arb](). The derivative
+/// `der` is not used; it is only kept for compatibility.
 LIBEANTIC_API int fmpz_poly_newton_step_arb(arb_t res, const fmpz_poly_t pol, const fmpz_poly_t der, arb_t a, slong prec);
 
+/// Refine the ball `a` that contains a single root of `(pol, len)` with
+/// Newton steps until its relative accuracy is at least `prec` bits and set
+/// `res` to the result.
+/// The working precision is doubled in each step so that the total cost is
+/// of the order of a few evaluations at precision `prec`. `extra_prec` is the
+/// number of guard bits needed to evaluate the polynomial close to the root,
+/// e.g., the logarithm of its condition number there.
+/// Returns `0` if Newton's method did not converge from `a`, e.g., because the
+/// derivative vanishes on `a`. Then `res` is not modified.
+LIBEANTIC_API int _fmpz_poly_newton_refine_arb(arb_t res, const fmpz * pol, slong len, const arb_t a, slong extra_prec, slong prec);
+
 LIBEANTIC_API void _fmpz_poly_bisection_step_arf(arf_t l, arf_t r, const fmpz * pol, slong len, int sl, int sr, slong prec);
 
 LIBEANTIC_API int fmpz_poly_bisection_step_arb(arb_t res, const fmpz_poly_t pol, arb_t a, slong prec);
@@ -109,8 +221,63 @@ LIBEANTIC_API void fmpz_poly_squarefree_part(fmpz_poly_t res, fmpz_poly_t poly);
 LIBEANTIC_API void fmpz_poly_evaluate_at_one(fmpz_t res, fmpz * p, slong len);
 ///@}
 
+/// \name Sturm sequences
+///@{
+
+/// The Sturm sequence of an integral polynomial.
+///
+/// The sequence is computed once with the subresultant algorithm which keeps
+/// the coefficients of its elements small without computing their content.
+/// Each element is a positive multiple of the corresponding element of the
+/// classical Sturm sequence, so that root counts can be obtained from the
+/// signs of the elements at the endpoints of an interval only.
+///
+/// The attributes are not part of the API and should not be accessed directly.
+typedef struct LIBEANTIC_API fmpz_poly_sturm
+{
+    /// The elements of the sequence starting with the polynomial itself.
+    /// If the polynomial is not squarefree, all elements have been divided
+    /// by the greatest common divisor of the polynomial and its derivative.
+    fmpz_poly_struct * seq;
+
+    /// The number of elements in `seq`.
+    slong length;
+
+    /// The number of polynomials for which memory has been allocated.
+    slong alloc;
+} fmpz_poly_sturm;
+
+/// The Sturm sequence of an integral polynomial.
+///
+/// Actually, this is an array of \ref fmpz_poly_sturm of length one.
+typedef fmpz_poly_sturm fmpz_poly_sturm_t[1];
+
+/// Initialize `S` with the Sturm sequence of the nonzero polynomial `pol`.
+/// Once done with `S`, the memory must be freed with [fmpz_poly_sturm_clear]().
+LIBEANTIC_API void fmpz_poly_sturm_init(fmpz_poly_sturm_t S, const fmpz_poly_t pol);
+
+/// Deallocate the memory for `S` that was allocated with [fmpz_poly_sturm_init]().
+LIBEANTIC_API void fmpz_poly_sturm_clear(fmpz_poly_sturm_t S);
+
+/// Return the number of distinct real roots of the polynomial of `S`.
+LIBEANTIC_API slong fmpz_poly_sturm_num_real_roots(const fmpz_poly_sturm_t S);
+
+/// Return the number of distinct roots of the polynomial of `S` in the
+/// closed interval [`a`, `b`]. Returns zero if `a` is larger than `b`.
+LIBEANTIC_API slong fmpz_poly_sturm_num_roots_fmpq(const fmpz_poly_sturm_t S, const fmpq_t a, const fmpq_t b);
+
+/// Return the number of distinct roots of the polynomial of `S` in the
+/// closed interval spanned by the ball `a`.
+/// The signs at the endpoints are determined with arb at `prec` bits of
+/// precision. Only the signs that cannot be decided this way are computed
+/// exactly.
+LIBEANTIC_API slong fmpz_poly_sturm_num_roots_arb(const fmpz_poly_sturm_t S, const arb_t a, slong prec);
+///@}
+
 /// \name Miscellaneous
 ///@{
+/// Return the number of distinct roots of `pol` in the closed interval [0, 1]
+/// with a Sturm sequence, see \ref fmpz_poly_sturm.
 LIBEANTIC_API slong fmpz_poly_num_real_roots_0_1_sturm(fmpz_poly_t pol);
 
 LIBEANTIC_API slong fmpz_poly_num_real_roots_0_1_vca(fmpz_poly_t pol);
@@ -126,9 +293,23 @@ LIBEANTIC_API slong fmpz_poly_num_real_roots_vca(fmpz_poly_t pol);
 /// of the ones in `p`
 LIBEANTIC_API void fmpz_poly_abs(fmpz_poly_t res, fmpz_poly_t p);
 
-/// Evaluate the polynomial `pol` at the ball `a` and set result in `res`
+/// Evaluate the polynomial `pol` at the ball `a` and set result in `res`.
+/// Depending on `len` and `prec`, this uses
+/// [_fmpz_poly_evaluate_arb_horner]() or
+/// [_fmpz_poly_evaluate_arb_rectangular]().
 LIBEANTIC_API void _fmpz_poly_evaluate_arb(arb_t res, const fmpz * pol, slong len, const arb_t a, slong prec);
 
+/// Evaluate the polynomial `pol` at the ball `a` with Horner's rule and set
+/// result in `res`. `res` and `a` must not be aliased.
+LIBEANTIC_API void _fmpz_poly_evaluate_arb_horner(arb_t res, const fmpz * pol, slong len, const arb_t a, slong prec);
+
+/// Evaluate the polynomial `pol` at the ball `a` with rectangular splitting
+/// (Paterson–Stockmeyer) and set result in `res`.
+/// Only about \f$2\sqrt{len}\f$ multiplications of balls are needed. The
+/// remaining work consists of dot products of the powers of `a` with the
+/// integral coefficients of `pol`.
+LIBEANTIC_API void _fmpz_poly_evaluate_arb_rectangular(arb_t res, const fmpz * pol, slong len, const arb_t a, slong prec);
+
 LIBEANTIC_API void fmpz_poly_evaluate_arb(arb_t b, const fmpz_poly_t pol, const arb_t a, slong prec);
 
 LIBEANTIC_API void _fmpz_poly_evaluate_arf(arf_t res, const fmpz * pol, slong len, const arf_t a, slong prec);
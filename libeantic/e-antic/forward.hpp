@@ -20,6 +20,8 @@ namespace eantic {
 
 class renf_elem_class;
 class renf_class;
+class renf_elem_intern_pool;
+class renf_matrix;
 
 }
 
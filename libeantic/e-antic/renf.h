@@ -38,6 +38,37 @@
 extern "C" {
 #endif
 
+/// Counters of events that are relevant for the performance of arithmetic
+/// in a number field, see [renf_get_statistics]().
+///
+/// The counters are only maintained when e-antic has been configured with
+/// `--enable-statistics`. Otherwise, they are always zero.
+typedef struct LIBEANTIC_API renf_statistics
+{
+  /// The number of calls to [renf_refine_embedding]().
+  ulong refinements;
+
+  /// The number of times that [renf_elem_sgn](), [renf_elem_cmp](),
+  /// [renf_elem_cmp_fmpq](), [renf_elem_floor](), [renf_elem_ceil](), or
+  /// [renf_elem_get_d]() had to compute an enclosure at a higher precision.
+  ulong escalations;
+
+  /// The highest precision of such an enclosure.
+  ulong max_prec;
+
+  /// The number of times that [renf_elem_cmp]() had to compute the exact
+  /// difference of the elements it compares.
+  ulong cmp_differences;
+
+  /// The number of times that the C++ interface performed arithmetic with
+  /// elements of different fields.
+  ulong coercions;
+} renf_statistics;
+
+/// The part of a number field that is shared between its copies.
+/// Its definition is internal to e-antic.
+struct renf_shared;
+
 /// Internal representation of a real embedded number field.
 ///
 /// The attributes are not part of the API and should be accessed directly. The
@@ -50,21 +81,52 @@ extern "C" {
 typedef struct LIBEANTIC_API renf
 {
   /// An algebraic number field, provided by FLINT (formerly ANTIC.)
-  nf_t nf;
+  /// This points into `shared`.
+  nf_struct * nf;
 
   /// The derivative of the defining polynomial (without denominator) as a
   /// FLINT polynomial over the integers.
-  fmpz_poly_t der;
+  /// This points into `shared`.
+  fmpz_poly_struct * der;
+
+  /// The reference counted storage of `nf` and `der`. These never change
+  /// once the number field has been created, so copies made with
+  /// [renf_init_set]() share them.
+  struct renf_shared * shared;
 
   /// Precision (number of bits) used for binary operations on enclosures.
+  /// This changes within `prec_min` and `prec_max` depending on how often
+  /// predicates cannot be decided from enclosures.
   slong prec;
 
+  /// Lower bound for `prec`.
+  slong prec_min;
+
+  /// Upper bound for `prec`.
+  slong prec_max;
+
+  /// The number of sign and comparison predicates evaluated in this field
+  /// that could not be decided by the exact representation alone.
+  ulong predicates;
+
+  /// The number of `predicates` for which the enclosures at precision
+  /// `prec` were not good enough and had to be recomputed.
+  ulong escalations;
+
+  /// The values of `predicates` and `escalations` when `prec` was last
+  /// adapted.
+  ulong predicates_adapted;
+  ulong escalations_adapted;
+
   /// The real embedding of the generator of this number field, given as ball
   /// in the reals.
   arb_t emb;
 
   /// A flag used during refinements to ensure thread-safety.
   int immutable;
+
+  /// Counters of events in this number field.
+  renf_statistics statistics;
 } renf;
 
 /// A real embedded number field.
@@ -104,6 +166,9 @@ LIBEANTIC_API void renf_init(renf_t nf, fmpq_poly_t pol, arb_t emb, slong prec);
 LIBEANTIC_API void renf_init_nth_root_fmpq(renf_t nf, fmpq_t d, ulong n, slong prec);
 
 /// Copy `src` to `dest`.
+/// The copy shares the underlying FLINT number field with `src` and only
+/// duplicates the embedding, so it is cheap to give each thread its own copy
+/// of a number field.
 LIBEANTIC_API void renf_init_set(renf_t dest, const renf_t src);
 
 /// Deallocate the number field `nf` originally allocated with one of the
@@ -111,8 +176,17 @@ LIBEANTIC_API void renf_init_set(renf_t dest, const renf_t src);
 LIBEANTIC_API void renf_clear(renf_t nf);
 
 /// Set the `lim` first elements of the array `nf` to the real embeddings of
-/// the irreducible polynomial `pol`. Each number field is initialized with a
-/// default `prec` of bit precision for binary operations.
+/// the polynomial `pol` and return the number of real roots of `pol`.
+/// The embeddings are ordered by increasing root. Each number field is
+/// defined by the irreducible factor of `pol` that has the corresponding
+/// root, in particular, rational roots lead to number fields of degree one.
+/// Each number field is initialized with a default `prec` of bit precision
+/// for binary operations.
+///
+/// Since the roots are isolated at once, the number fields are not checked
+/// individually to define a unique root. The embeddings are refined
+/// concurrently with as many threads as are configured with
+/// `flint_set_num_threads`.
 LIBEANTIC_API slong renf_set_embeddings_fmpz_poly(renf * nf, fmpz_poly_t pol, slong lim, slong prec);
 
 /// Refine the embedding of `nf` to `prec` bits of precision.
@@ -127,6 +201,44 @@ LIBEANTIC_API void renf_refine_embedding(renf_t nf, slong prec);
 /// This method is used internally as a sanity-check in multi-threaded code.
 LIBEANTIC_API int renf_set_immutable(renf_t nf, int immutable);
 
+/// Let the precision used for binary operations on enclosures of elements
+/// of `nf` adapt automatically between `prec_min` and `prec_max` bits.
+/// When predicates such as [renf_elem_sgn]() or [renf_elem_cmp]() often need
+/// to recompute enclosures at a higher precision, the precision is raised.
+/// When enclosures are always good enough, it is lowered.
+/// Initially, the bounds are both the precision given when `nf` was
+/// created, i.e., the precision does not change.
+/// The precision of an immutable number field does not change.
+/// Since predicates then modify `nf`, a number field with a proper range of
+/// precisions must not be used by several threads at the same time; give
+/// each thread its own copy made with [renf_init_set]() instead.
+LIBEANTIC_API void renf_set_prec_range(renf_t nf, slong prec_min, slong prec_max);
+
+/// Set `predicates` to the number of sign and comparison predicates that
+/// have been decided with enclosures in `nf` and `escalations` to the number
+/// of these that needed more precise enclosures. Predicates are only counted
+/// while the precision of `nf` adapts, see [renf_set_prec_range](), and not
+/// while `nf` is immutable.
+LIBEANTIC_API void renf_get_predicate_statistics(ulong * predicates, ulong * escalations, const renf_t nf);
+
+/// Set `statistics` to the counters of events in `nf`.
+/// Copies of a number field made with [renf_init_set]() count separately.
+LIBEANTIC_API void renf_get_statistics(renf_statistics * statistics, const renf_t nf);
+
+/// Set `statistics` to the counters of events in all number fields.
+LIBEANTIC_API void renf_get_global_statistics(renf_statistics * statistics);
+
+/// Reset the counters of events in `nf` to zero.
+LIBEANTIC_API void renf_reset_statistics(renf_t nf);
+
+/// Reset the counters of events in all number fields to zero.
+/// The counters of the individual fields are not affected.
+LIBEANTIC_API void renf_reset_global_statistics(void);
+
+/// Return whether e-antic has been built with `--enable-statistics`, i.e.,
+/// whether the counters returned by [renf_get_statistics]() are maintained.
+LIBEANTIC_API int renf_statistics_enabled(void);
+
 /// Return whether the two number fields are equal.
 /// Two embedded number field are considered equal if they define the same
 /// subfield of the real numbers.  The precision of the embedding or the
@@ -149,6 +261,29 @@ LIBEANTIC_API char * renf_get_str(const renf_t nf, const char * var, slong prec)
 /// Print the number field on the standard output.
 LIBEANTIC_API void renf_print(const renf_t nf);
 
+/// \name Internal Functions
+/// These functions are used internally and not part of the API.
+///@{
+
+/// Set `nf` to be the real embedded number field defined by the irreducible
+/// polynomial `pol` and the embedding `emb` like [renf_init]() but without
+/// checking that `emb` isolates a unique root of `pol` and without refining
+/// `emb` to `prec` bits.
+LIBEANTIC_API void _renf_init(renf_t nf, fmpq_poly_t pol, arb_t emb, slong prec);
+
+/// Record that a predicate has been evaluated with the enclosures of
+/// elements of `nf` and whether more precise enclosures had to be computed
+/// (`escalated`.) Adapts the precision of `nf`, see [renf_set_prec_range]().
+LIBEANTIC_API void _renf_record_predicate(renf_t nf, int escalated);
+
+/// Count that the C++ interface performed arithmetic with an element of
+/// `nf` and an element of another field, see [renf_get_statistics]().
+LIBEANTIC_API void _renf_count_coercion(renf_t nf);
+
+/// The counters of events in all number fields.
+LIBEANTIC_API extern renf_statistics _renf_global_statistics;
+///@}
+
 #ifdef __cplusplus
 }
 #endif
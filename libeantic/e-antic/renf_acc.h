@@ -0,0 +1,116 @@
+/// Accumulators for sums of embedded number field elements
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef E_ANTIC_RENF_ACC_H
+#define E_ANTIC_RENF_ACC_H
+
+#include "local.h"
+
+#include <flint/fmpz.h>
+#include <flint/fmpq.h>
+
+#include "renf.h"
+#include "renf_elem.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// An accumulator for long sums of elements of a real embedded number field.
+///
+/// Adding two elements with [renf_elem_add]() brings the result into
+/// canonical form, i.e., it removes the common factors of the numerator and
+/// the denominator. For a sum of many terms, these gcd computations dominate
+/// the cost of the actual additions. An accumulator keeps its value over a
+/// common denominator which is only enlarged when a term does not fit it and
+/// postpones canonicalisation until the sum is retrieved with
+/// [renf_acc_finish]().
+/// ```
+/// renf_acc_t acc;
+/// renf_acc_init(acc, nf);
+/// for (i = 0; i < n; i++)
+///     renf_acc_add(acc, terms + i, nf);
+/// renf_acc_finish(sum, acc, nf);
+/// renf_acc_clear(acc);
+/// ```
+///
+/// The attributes are not part of the API and should not be accessed directly.
+typedef struct LIBEANTIC_API renf_acc
+{
+    /// The number of coefficients of the sum, i.e., the degree of the field.
+    slong degree;
+
+    /// The numerator of the sum written as a polynomial in the generator of
+    /// the number field. It is generally not coprime to `den`.
+    fmpz * num;
+
+    /// The denominator of the sum. This is a common multiple of the
+    /// denominators of all the terms added so far.
+    fmpz den;
+
+    /// An enclosure of the sum.
+    arb_t emb;
+} renf_acc;
+
+/// An accumulator for long sums of elements of a real embedded number field.
+///
+/// Actually, this is an array of \ref renf_acc of length one.
+typedef renf_acc renf_acc_t[1];
+
+/// Initialize `acc` as an accumulator of elements of `nf` with value zero.
+/// Once done with `acc`, the memory must be freed with [renf_acc_clear]().
+LIBEANTIC_API void renf_acc_init(renf_acc_t acc, const renf_t nf);
+
+/// Deallocate the memory for `acc` that was allocated with [renf_acc_init]().
+LIBEANTIC_API void renf_acc_clear(renf_acc_t acc);
+
+/// Reset the value of `acc` to zero.
+LIBEANTIC_API void renf_acc_zero(renf_acc_t acc);
+
+/// Add `a` to `acc`.
+LIBEANTIC_API void renf_acc_add(renf_acc_t acc, const renf_elem_t a, const renf_t nf);
+
+/// Subtract `a` from `acc`.
+LIBEANTIC_API void renf_acc_sub(renf_acc_t acc, const renf_elem_t a, const renf_t nf);
+
+/// Add the integer `c` to `acc`.
+LIBEANTIC_API void renf_acc_add_fmpz(renf_acc_t acc, const fmpz_t c, const renf_t nf);
+
+/// Add the rational `c` to `acc`.
+LIBEANTIC_API void renf_acc_add_fmpq(renf_acc_t acc, const fmpq_t c, const renf_t nf);
+
+/// Add the product of `a` and `b` to `acc`.
+/// The product is computed as with [renf_elem_mul](); only the sum is kept
+/// in non-canonical form.
+LIBEANTIC_API void renf_acc_addmul(renf_acc_t acc, const renf_elem_t a, const renf_elem_t b, const renf_t nf);
+
+/// Set `res` to the value of `acc` in canonical form.
+/// The accumulator is not modified and further terms can be added to it.
+LIBEANTIC_API void renf_acc_finish(renf_elem_t res, const renf_acc_t acc, const renf_t nf);
+
+/// \name Internal Functions
+/// These functions are used internally and not part of the API.
+///@{
+
+/// Add `sign` times the number field element with numerator coefficients
+/// `num` of length `len` and denominator `den` to the exact value of `acc`.
+LIBEANTIC_API void _renf_acc_add_fmpz_poly(renf_acc_t acc, const fmpz * num, slong len, const fmpz_t den, int sign);
+
+/// Add `sign` times the exact value of `a` to the exact value of `acc`.
+LIBEANTIC_API void _renf_acc_add_nf_elem(renf_acc_t acc, const nf_elem_t a, int sign, const renf_t nf);
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
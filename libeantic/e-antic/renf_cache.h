@@ -0,0 +1,165 @@
+/// Persistent cache of certified embeddings
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef E_ANTIC_RENF_CACHE_H
+#define E_ANTIC_RENF_CACHE_H
+
+#include "local.h"
+
+#include <pthread.h>
+
+#include "renf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// An entry of a \ref renf_cache.
+///
+/// The attributes are not part of the API and should not be accessed directly.
+typedef struct LIBEANTIC_API renf_cache_entry
+{
+    /// The precision to which `emb` has been refined.
+    slong prec;
+
+    /// The defining polynomial as produced by `fmpq_poly_get_str`.
+    char * pol;
+
+    /// The embedding that was used to create the number field as produced
+    /// by `arb_dump_str`.
+    char * key;
+
+    /// The certified and refined embedding as produced by `arb_dump_str`.
+    char * emb;
+
+    /// The number of bytes this entry takes in the file of the cache.
+    slong size;
+} renf_cache_entry;
+
+/// A cache of the embeddings of number fields that can be persisted to disk.
+///
+/// Creating a number field with [renf_init]() checks that the given embedding
+/// isolates a unique root of the defining polynomial and then refines the
+/// embedding. Both steps can be expensive for fields of large degree. When a
+/// cache has been installed with [renf_set_cache](), the refined embedding
+/// is stored in the cache and later calls to [renf_init]() with the same
+/// polynomial and the same initial embedding skip the certification and
+/// refinement.
+///
+/// The file of a cache is protected by a checksum. A cache whose file is
+/// missing or has been damaged starts out empty. Additionally, an embedding
+/// from the cache is only used if it is contained in the initial embedding.
+///
+/// The attributes are not part of the API and should not be accessed directly.
+typedef struct LIBEANTIC_API renf_cache
+{
+    /// The file this cache is read from and written to.
+    char * path;
+
+    /// The maximum size of the file in bytes, including its header and its
+    /// checksum.
+    slong limit;
+
+    /// The size of the entries when written to the file.
+    slong size;
+
+    /// The number of entries in the cache.
+    slong length;
+
+    /// The number of entries for which memory has been allocated.
+    slong alloc;
+
+    /// The entries ordered by their last use, most recent last.
+    renf_cache_entry * entries;
+
+    /// Whether the cache has changed since it was read from disk.
+    int dirty;
+
+    /// A lock to protect the cache when fields are created concurrently.
+    pthread_mutex_t mutex;
+} renf_cache;
+
+/// A cache of the embeddings of number fields that can be persisted to disk.
+///
+/// Actually, this is an array of \ref renf_cache of length one.
+typedef renf_cache renf_cache_t[1];
+
+/// Initialize `cache` with the entries stored in the file at `path`.
+/// Entries that do not fit into a file of `limit` bytes, including its
+/// header and checksum, are dropped, least recently used first.
+/// Returns `1` if the file could be read. If the file does not exist or it
+/// fails the integrity checks, returns `0` and the cache is empty.
+/// Once done with `cache`, the memory must be freed with [renf_cache_clear]().
+LIBEANTIC_API int renf_cache_init(renf_cache_t cache, const char * path, slong limit);
+
+/// Deallocate the memory for `cache`.
+/// The cache is not written to disk, use [renf_cache_write]() before to
+/// persist changes.
+LIBEANTIC_API void renf_cache_clear(renf_cache_t cache);
+
+/// Write `cache` to its file if it has changed since it was read.
+/// The file is replaced atomically so that concurrent readers never see a
+/// partially written cache.
+/// Returns `1` on success and `0` if the file could not be written.
+LIBEANTIC_API int renf_cache_write(renf_cache_t cache);
+
+/// Set `res` to the embedding stored in `cache` for a number field defined
+/// by `pol` and the initial embedding `emb` and return `1`. If there is no
+/// such embedding that has been refined to at least `prec` bits, return `0`.
+LIBEANTIC_API int renf_cache_get(arb_t res, renf_cache_t cache, const fmpq_poly_t pol, const arb_t emb, slong prec);
+
+/// Store in `cache` that `res` is the embedding, refined to `prec` bits, of
+/// the number field defined by `pol` and the initial embedding `emb`.
+/// The caller must have certified that `emb` isolates a unique root of
+/// `pol`.
+LIBEANTIC_API void renf_cache_set(renf_cache_t cache, const fmpq_poly_t pol, const arb_t emb, const arb_t res, slong prec);
+
+/// Install `cache` as the cache consulted by [renf_init]() and by the C++
+/// interface when creating number fields. Passing `NULL` uninstalls the
+/// current cache. Returns the previously installed cache.
+/// The cache must not be cleared while it is installed. This function is
+/// not thread-safe, so the cache should be installed before fields are
+/// created concurrently.
+LIBEANTIC_API renf_cache * renf_set_cache(renf_cache * cache);
+
+/// Return the cache installed with [renf_set_cache]() or `NULL` if there is
+/// no such cache.
+LIBEANTIC_API renf_cache * renf_get_cache(void);
+
+/// \name Internal Functions
+/// These functions are used internally and not part of the API.
+///@{
+
+/// The first line of a cache file which identifies the version of its format.
+#define RENF_CACHE_HEADER "e-antic renf cache 1\n"
+
+/// The number of bytes of a cache file that are not entries, i.e., the header
+/// and the last line that holds the checksum as 16 hexadecimal digits.
+#define RENF_CACHE_OVERHEAD ((slong) sizeof(RENF_CACHE_HEADER) - 1 + 17)
+
+/// Append an entry to `cache`, taking ownership of the strings `pol`, `key`
+/// and `emb`, and drop the least recently used entries that exceed the
+/// size limit.
+LIBEANTIC_API void _renf_cache_push(renf_cache_t cache, char * pol, char * key, char * emb, slong prec);
+
+/// Remove the entry at position `i` from `cache`.
+LIBEANTIC_API void _renf_cache_remove(renf_cache_t cache, slong i);
+
+/// Return the checksum that protects the `len` bytes `data` in a cache file.
+LIBEANTIC_API ulong _renf_cache_checksum(const char * data, slong len);
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -20,9 +20,12 @@
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 #include <string>
 #include <atomic>
+#include <functional>
 
 #include "forward.hpp"
 #include "renf.h"
+#include "renf_hom.h"
+#include "renf_trace.h"
 
 namespace eantic {
 
@@ -71,6 +74,23 @@ class LIBEANTIC_API renf_class
   {
     renf_class(const ::renf_t, const std::string &);
 
+    // Tag to select the constructor that takes ownership of a renf_t.
+    struct adopt_t {};
+
+    // Create a field from a renf_t without copying it. The renf_t is cleared
+    // when this field is destroyed and must not be cleared by the caller.
+    renf_class(::renf_t, const std::string &, adopt_t);
+
+    // The embeddings of this field into other fields that have been
+    // registered with register_embedding().
+    struct embeddings;
+
+    // Return the embedding of this field into `L` that has been registered
+    // with register_embedding() or nullptr if there is no such embedding.
+    const ::renf_hom* embedding(const renf_class& L) const;
+
+    friend class renf_elem_class;
+
 public:
     /// Return the trivial number field obtained by adjoining a root of \f$x - 1\f$ to the rationals.
     static const renf_class& make();
@@ -158,6 +178,67 @@ public:
     /// Return the absolute degree of this number field.
     slong degree() const;
 
+    /// Return the counters of events that are relevant for the performance
+    /// of arithmetic in this field, see [renf_get_statistics]().
+    /// The counters are only maintained when e-antic has been configured
+    /// with `--enable-statistics`.
+    /// ```
+    /// auto K = eantic::renf_class::make("x^2 - 2", "x", "1.4 +/- 1");
+    /// K->statistics().cmp_differences
+    /// // -> 0
+    /// ```
+    renf_statistics statistics() const;
+
+    /// Reset the counters returned by [statistics]() to zero.
+    void reset_statistics() const;
+
+    /// Invoke `callback` whenever an expensive operation such as a
+    /// refinement of an embedding completes in any number field, see
+    /// [renf_set_trace](). Passing an empty function disables tracing.
+    /// This may be called while other threads operate on number fields. The
+    /// previous callback might still receive events that were reported
+    /// concurrently.
+    /// ```
+    /// size_t constructions = 0;
+    /// eantic::renf_class::set_trace([&](const renf_trace_event& event) {
+    ///     if (event.kind == RENF_TRACE_CONSTRUCTION) constructions++;
+    /// });
+    ///
+    /// auto K = eantic::renf_class::make("x^3 - 3", "x", "1.44 +/- 1");
+    /// eantic::renf_class::set_trace({});
+    ///
+    /// constructions
+    /// // -> 1
+    /// ```
+    static void set_trace(std::function<void(const renf_trace_event&)> callback);
+
+    /// Register the embedding of this field into the parent of `image` that
+    /// sends the generator of this field to `image`.
+    /// Throws an `std::invalid_argument` if `image` is not a root of the
+    /// defining polynomial of this field or if its real embedding is not the
+    /// one of the generator of this field.
+    /// Once registered, elements of this field are mapped into the parent of
+    /// `image` by [renf_elem_class(const renf_class&, const renf_elem_class&)]
+    /// and by arithmetic between elements of both fields. The embedding does
+    /// not keep the parent of `image` alive; it is forgotten once that field
+    /// is destroyed.
+    /// ```
+    /// #include <e-antic/renf_class.hpp>
+    /// #include <e-antic/renf_elem_class.hpp>
+    ///
+    /// auto K = eantic::renf_class::make("x^2 - 2", "x", "1.4 +/- 1");
+    /// auto L = eantic::renf_class::make("y^4 - 2", "y", "1.19 +/- 0.1");
+    /// K->register_embedding(L->gen() * L->gen());
+    ///
+    /// std::cout << eantic::renf_elem_class(*L, K->gen());
+    /// // -> (y^2 ~ 1.4142136)
+    /// ```
+    void register_embedding(const renf_elem_class& image) const;
+
+    /// Return whether an embedding of this field into `L` has been
+    /// registered with [register_embedding]().
+    bool has_embedding(const renf_class& L) const;
+
     /// Return the zero element of this number field.
     const renf_elem_class& zero() const;
 
@@ -274,6 +355,10 @@ private:
     // generator.
     renf_elem_class* cache;
 
+    // The embeddings registered with register_embedding() or nullptr if
+    // there are none.
+    mutable embeddings* homs;
+
     // Serialization, see [cereal.hpp]().
     friend cereal::access;
 
@@ -88,7 +88,9 @@ public:
 
     /// Create an element in the field `k` from an existing element.
     /// This attempts to coerce the element into the field `k`. Currently, this
-    /// is only implemented in trivial cases.
+    /// is only implemented for rational elements and when an embedding of the
+    /// parent of the element into `k` has been registered with
+    /// [renf_class::register_embedding]().
     renf_elem_class(const renf_class& k, const renf_elem_class&);
 
     /// Create an element in the field `k` from a string representation of its
@@ -394,6 +396,53 @@ public:
     renf_elem_class & operator/=(const renf_elem_class &);
     ///@}
 
+    /// How arithmetic between elements of different number fields is
+    /// handled when neither field is the rational field and no embedding has
+    /// been registered with [renf_class::register_embedding](). Such
+    /// arithmetic is deprecated, see
+    /// https://github.com/flatsurf/e-antic/issues/126.
+    enum class mixed_parents {
+        /// Print a deprecation warning once for each pair of number fields.
+        warn_once,
+        /// Print a deprecation warning for every operation.
+        warn,
+        /// Perform the operation silently.
+        allow,
+        /// Throw an `std::invalid_argument`.
+        raise,
+    };
+
+    /// Set how arithmetic between elements of different number fields is
+    /// handled. The default is [mixed_parents::raise] if the environment
+    /// variable `LIBEANTIC_STRICT_BINOP` is set and
+    /// [mixed_parents::warn_once] otherwise.
+    /// ```
+    /// #include <e-antic/renf_class.hpp>
+    /// #include <e-antic/renf_elem_class.hpp>
+    ///
+    /// auto K = eantic::renf_class::make("x^2 - 2", "x", "1.4 +/- 1");
+    /// auto L = eantic::renf_class::make("x^2 - 3", "x", "1.7 +/- 1");
+    ///
+    /// eantic::renf_elem_class::set_mixed_parents(eantic::renf_elem_class::mixed_parents::allow);
+    /// auto operations = eantic::renf_elem_class::mixed_parents_count();
+    ///
+    /// std::cout << K->gen() + L->one();
+    /// // -> (x+1 ~ 2.4142136)
+    ///
+    /// eantic::renf_elem_class::mixed_parents_count() - operations
+    /// // -> 1
+    /// ```
+    static void set_mixed_parents(mixed_parents policy);
+
+    /// Return how arithmetic between elements of different number fields is
+    /// handled, see [set_mixed_parents]().
+    static mixed_parents get_mixed_parents();
+
+    /// Return the number of deprecated arithmetic operations between elements
+    /// of different number fields that have been performed or rejected by
+    /// this process, see [set_mixed_parents]().
+    static size_t mixed_parents_count();
+
     /// Add `a*b` to this element and return this element.
     /// This is more efficient than `x += a*b` which creates more temporaries.
     ///@{
@@ -573,8 +622,15 @@ private:
     // stored embedding.
     mutable ::renf_elem_t a;
 
+    // Forget the deprecation warnings printed for arithmetic involving `nf`
+    // so that a field allocated at the same address later warns again.
+    // Called when `nf` is destroyed.
+    static void forget_mixed_parents(const renf_class& nf);
+
     // Allow access by serialization, see cereal.hpp
     friend cereal::access;
+
+    friend class renf_class;
 };
 
 // Return the integer floor of the element.
@@ -0,0 +1,161 @@
+/*  This is a -*- C++ -*- header file.
+
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+/// Interning of Number Field Elements
+
+#ifndef E_ANTIC_RENF_ELEM_INTERN_POOL_HPP
+#define E_ANTIC_RENF_ELEM_INTERN_POOL_HPP
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "forward.hpp"
+#include "renf_elem_class.hpp"
+
+namespace eantic {
+
+/// A pool of distinct elements of a fixed number field.
+///
+/// Interning an element returns a compact integer handle. Equal elements are
+/// mapped to the same handle, so comparing handles is equivalent to comparing
+/// the underlying elements but takes constant time. All handles that are alive
+/// refer to a single canonical copy of their element, i.e., the memory used by
+/// the pool is bounded by the number of distinct values in it.
+/// ```
+/// #include <e-antic/renf_class.hpp>
+/// #include <e-antic/renf_elem_class.hpp>
+/// #include <e-antic/renf_elem_intern_pool.hpp>
+///
+/// auto K = eantic::renf_class::make("x^2 - 2", "x", "1.4 +/- 1");
+/// eantic::renf_elem_intern_pool pool(*K);
+///
+/// auto a = pool.intern(K->gen() + 1);
+/// auto b = pool.intern(1 + K->gen());
+/// a == b
+/// // -> true
+///
+/// std::cout << pool[a];
+/// // -> (x+1 ~ 2.4142136)
+///
+/// pool.size()
+/// // -> 1
+/// ```
+///
+/// Every call to \ref intern acquires a reference to the returned handle which
+/// must eventually be given up with \ref release. Elements without references
+/// stay in the pool until \ref evict is called, unless the pool has been
+/// created with automatic eviction:
+/// ```
+/// #include <e-antic/renf_class.hpp>
+/// #include <e-antic/renf_elem_class.hpp>
+/// #include <e-antic/renf_elem_intern_pool.hpp>
+///
+/// auto K = eantic::renf_class::make("x^2 - 2", "x", "1.4 +/- 1");
+/// eantic::renf_elem_intern_pool pool(*K);
+///
+/// pool.release(pool.intern(K->gen()));
+/// pool.size()
+/// // -> 1
+/// pool.evict()
+/// // -> 1
+/// pool.size()
+/// // -> 0
+/// ```
+///
+/// A pool is not thread-safe. Callers need to synchronize concurrent access
+/// to the same pool themselves.
+class LIBEANTIC_API renf_elem_intern_pool {
+public:
+    /// The compact representation of an element in this pool.
+    /// Two handles obtained from the same pool are equal if and only if the
+    /// underlying elements are equal.
+    using handle = std::uint32_t;
+
+    /// Create an empty pool of elements of the field `k`.
+    /// If `evict_unreferenced` is set, elements are removed from the pool as
+    /// soon as their last reference has been released.
+    explicit renf_elem_intern_pool(const renf_class& k, bool evict_unreferenced = false);
+
+    renf_elem_intern_pool(const renf_elem_intern_pool&) = delete;
+    renf_elem_intern_pool& operator=(const renf_elem_intern_pool&) = delete;
+
+    /// Return the handle of `x` and acquire a reference to it.
+    /// If `x` is not in the pool yet, it is added to it. The element `x` must
+    /// be in the field of this pool or be rational.
+    handle intern(const renf_elem_class& x);
+
+    /// Return the handle of `x` if it is in the pool already.
+    /// No reference is acquired by this lookup. Returns `false` if `x` is not
+    /// in the pool.
+    bool find(const renf_elem_class& x, handle& h) const;
+
+    /// Return the canonical element of the handle `h`.
+    /// The reference is valid until `h` is evicted from the pool.
+    const renf_elem_class& operator[](handle h) const;
+
+    /// Acquire another reference to the handle `h`.
+    void retain(handle h);
+
+    /// Release a reference to the handle `h`.
+    void release(handle h);
+
+    /// Return the number of references currently held to the handle `h`.
+    std::size_t references(handle h) const;
+
+    /// Remove all elements that are not referenced anymore from the pool.
+    /// Returns the number of elements that have been removed.
+    /// The handles of removed elements might be reused by later calls to
+    /// \ref intern.
+    std::size_t evict();
+
+    /// Return the number of distinct elements currently stored in the pool.
+    std::size_t size() const;
+
+    /// Return the number field of the elements in this pool.
+    const renf_class& parent() const { return *nf; }
+
+private:
+    struct slot {
+        renf_elem_class value;
+        std::size_t hash;
+        std::size_t references;
+        bool occupied;
+    };
+
+    void erase(handle h);
+
+    // The number field all elements live in.
+    boost::intrusive_ptr<const renf_class> nf;
+
+    // Whether elements are evicted when their last reference is released.
+    bool evict_unreferenced;
+
+    // The elements indexed by their handle. We use a deque so that references
+    // to the canonical elements remain valid when the pool grows.
+    std::deque<slot> slots;
+
+    // Handles of unoccupied slots that can be reused.
+    std::vector<handle> unused;
+
+    // Maps the exact hash of an element to the handles with that hash.
+    std::unordered_multimap<std::size_t, handle> index;
+
+    // The number of occupied slots.
+    std::size_t occupied;
+};
+
+}
+
+#endif
@@ -0,0 +1,75 @@
+/// Embeddings between embedded number fields
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef E_ANTIC_RENF_HOM_H
+#define E_ANTIC_RENF_HOM_H
+
+#include "local.h"
+
+#include <flint/fmpz.h>
+#include <flint/fmpz_mat.h>
+
+#include "renf.h"
+#include "renf_elem.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// An embedding of a real embedded number field `K` into a real embedded
+/// number field `L`, i.e., a field homomorphism that is compatible with the
+/// real embeddings of `K` and `L`.
+///
+/// Such an embedding is determined by the image of the generator of `K`. To
+/// map elements quickly, the images of the powers \f$1, x, …, x^{n-1}\f$ of
+/// the generator of `K` are precomputed. Mapping an element is then a
+/// product of an integer matrix with the vector of coefficients of the
+/// element.
+///
+/// The attributes are not part of the API and should not be accessed directly.
+typedef struct LIBEANTIC_API renf_hom
+{
+    /// The numerators of the images of the powers of the generator of `K`.
+    /// The column `j` holds the coefficients of the image of \f$x^j\f$ as a
+    /// polynomial in the generator of `L`.
+    fmpz_mat_t num;
+
+    /// The common denominator of the entries of `num`.
+    fmpz_t den;
+} renf_hom;
+
+/// An embedding of real embedded number fields.
+///
+/// Actually, this is an array of \ref renf_hom of length one.
+typedef renf_hom renf_hom_t[1];
+
+/// Initialize `f` as the embedding of `K` into `L` that sends the generator of
+/// `K` to `image` and return `1`.
+/// If `image` is not a root of the defining polynomial of `K` or its real
+/// embedding differs from the one of the generator of `K`, i.e., there is no
+/// such embedding, return `0`. In that case, `f` does not need to be cleared.
+/// The embeddings of `K` and `L` might be refined in the process.
+/// Once done with `f`, the memory must be freed with [renf_hom_clear]().
+LIBEANTIC_API int renf_hom_init(renf_hom_t f, renf_t K, const renf_elem_t image, renf_t L);
+
+/// Deallocate the memory for `f` that was allocated with [renf_hom_init]().
+LIBEANTIC_API void renf_hom_clear(renf_hom_t f);
+
+/// Set `res` to the image of the element `a` of `K` in `L` under the
+/// embedding `f`.
+LIBEANTIC_API void renf_hom_apply(renf_elem_t res, const renf_elem_t a, const renf_hom_t f, const renf_t K, renf_t L);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,222 @@
+/// Matrices over embedded number fields
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef E_ANTIC_RENF_MAT_H
+#define E_ANTIC_RENF_MAT_H
+
+#include "local.h"
+
+#include "renf.h"
+#include "renf_elem.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// A dense matrix over a real embedded number field.
+///
+/// The entries are stored contiguously in row-major order. As for the
+/// matrix types of FLINT, the rows are accessed through an array of pointers
+/// into the entries so that rows can be swapped in constant time.
+///
+/// The attributes are not part of the API and should not be accessed
+/// directly. Use [renf_mat_entry]() to access the entries.
+typedef struct LIBEANTIC_API renf_mat
+{
+    /// The entries of this matrix.
+    renf_elem * entries;
+
+    /// The number of rows of this matrix.
+    slong r;
+
+    /// The number of columns of this matrix.
+    slong c;
+
+    /// Pointers to the first entry of each row.
+    renf_elem ** rows;
+} renf_mat;
+
+/// A dense matrix over a real embedded number field.
+///
+/// Actually, this is an array of \ref renf_mat of length one.
+typedef renf_mat renf_mat_t[1];
+
+/// Return a pointer to the entry in row `i` and column `j` of `mat`.
+#define renf_mat_entry(mat, i, j) ((mat)->rows[i] + (j))
+
+/// Return the number of rows of `mat`.
+static __inline__
+slong renf_mat_nrows(const renf_mat_t mat)
+{
+    return mat->r;
+}
+
+/// Return the number of columns of `mat`.
+static __inline__
+slong renf_mat_ncols(const renf_mat_t mat)
+{
+    return mat->c;
+}
+
+/// Initialize `mat` as the zero matrix with `rows` rows and `cols` columns
+/// over the field `nf`.
+/// Once done with `mat`, the memory must be freed with [renf_mat_clear]().
+LIBEANTIC_API void renf_mat_init(renf_mat_t mat, slong rows, slong cols, const renf_t nf);
+
+/// Deallocate the memory for `mat` that was allocated with [renf_mat_init]().
+LIBEANTIC_API void renf_mat_clear(renf_mat_t mat, const renf_t nf);
+
+/// Swap the matrices `mat1` and `mat2`.
+static __inline__
+void renf_mat_swap(renf_mat_t mat1, renf_mat_t mat2)
+{
+    renf_mat t = *mat1;
+    *mat1 = *mat2;
+    *mat2 = t;
+}
+
+/// Swap the rows `r` and `s` of `mat`.
+/// If `perm` is not `NULL`, the entries `r` and `s` of `perm` are swapped as
+/// well.
+static __inline__
+void renf_mat_swap_rows(renf_mat_t mat, slong * perm, slong r, slong s)
+{
+    if (r != s)
+    {
+        renf_elem * t = mat->rows[r];
+        mat->rows[r] = mat->rows[s];
+        mat->rows[s] = t;
+
+        if (perm != NULL)
+        {
+            slong u = perm[r];
+            perm[r] = perm[s];
+            perm[s] = u;
+        }
+    }
+}
+
+/// Set `mat1` to a copy of `mat2`. The matrices must have the same dimensions.
+LIBEANTIC_API void renf_mat_set(renf_mat_t mat1, const renf_mat_t mat2, const renf_t nf);
+
+/// Set all entries of `mat` to zero.
+LIBEANTIC_API void renf_mat_zero(renf_mat_t mat, const renf_t nf);
+
+/// Set `mat` to the identity matrix, i.e., set the entries on the main
+/// diagonal to one and all other entries to zero.
+LIBEANTIC_API void renf_mat_one(renf_mat_t mat, const renf_t nf);
+
+/// Return whether `mat1` and `mat2` have the same dimensions and entries.
+LIBEANTIC_API int renf_mat_equal(const renf_mat_t mat1, const renf_mat_t mat2, const renf_t nf);
+
+/// Return whether all entries of `mat` are zero.
+LIBEANTIC_API int renf_mat_is_zero(const renf_mat_t mat, const renf_t nf);
+
+/// Set the entries of `mat` to random elements of `nf` whose coefficients
+/// have at most `bits` bits.
+LIBEANTIC_API void renf_mat_randtest(renf_mat_t mat, flint_rand_t state, mp_bitcnt_t bits, renf_t nf);
+
+/// Print `mat` to the standard output. The entries are printed as with
+/// [renf_elem_print_pretty]().
+LIBEANTIC_API void renf_mat_print_pretty(const renf_mat_t mat, const char * var, renf_t nf, slong n, int flag);
+
+/// Set `C` to the matrix product of `A` and `B`.
+/// The number of columns of `A` must match the number of rows of `B` and `C`
+/// must have the dimensions of the product. Aliasing is allowed.
+/// Depending on the dimensions, this calls [renf_mat_mul_classical]() or
+/// [renf_mat_mul_multimod]().
+LIBEANTIC_API void renf_mat_mul(renf_mat_t C, const renf_mat_t A, const renf_mat_t B, renf_t nf);
+
+/// Set `C` to the matrix product of `A` and `B` by computing each entry as
+/// a sum of products in the number field.
+LIBEANTIC_API void renf_mat_mul_classical(renf_mat_t C, const renf_mat_t A, const renf_mat_t B, renf_t nf);
+
+/// Set `C` to the matrix product of `A` and `B` with a multimodular
+/// algorithm.
+/// The product is computed modulo word-size primes `p` for which the
+/// defining polynomial is either irreducible or splits into distinct linear
+/// factors modulo `p` with fast matrix multiplication over finite fields. The
+/// result is then reconstructed with the Chinese remainder theorem. The
+/// number of primes is chosen from an a priori bound on the size of the
+/// result so the output is exact.
+LIBEANTIC_API void renf_mat_mul_multimod(renf_mat_t C, const renf_mat_t A, const renf_mat_t B, renf_t nf);
+
+/// Compute a fraction-free LU decomposition of `A` with Bareiss' algorithm.
+/// Sets `B` to an upper triangular row echelon form of `A` whose entries are
+/// minors of `A` (up to sign) and `den` to the last nonzero pivot. Returns the
+/// rank of `A`. The row permutation is applied to `perm` if it is not
+/// `NULL`. If `rank_check` is set, the elimination stops and returns zero as
+/// soon as `A` is found not to have full row rank.
+LIBEANTIC_API slong renf_mat_fflu(renf_mat_t B, renf_elem_t den, slong * perm, const renf_mat_t A, int rank_check, renf_t nf);
+
+/// Set `B` to the reduced row echelon form of `A` and return the rank of `A`.
+LIBEANTIC_API slong renf_mat_rref(renf_mat_t B, const renf_mat_t A, renf_t nf);
+
+/// Return the rank of `A`.
+/// Depending on the dimensions, this calls [renf_mat_rank_fflu]() or
+/// [renf_mat_rank_multimod]().
+LIBEANTIC_API slong renf_mat_rank(const renf_mat_t A, renf_t nf);
+
+/// Return the rank of `A` computed with [renf_mat_fflu]().
+LIBEANTIC_API slong renf_mat_rank_fflu(const renf_mat_t A, renf_t nf);
+
+/// Return the rank of `A` computed with a multimodular algorithm.
+/// The rank of `A` modulo a prime can only be smaller than the actual rank if
+/// the prime divides the coefficients of all maximal nonzero minors. Primes
+/// are added until their product exceeds a bound on these coefficients or
+/// the rank is maximal.
+LIBEANTIC_API slong renf_mat_rank_multimod(const renf_mat_t A, renf_t nf);
+
+/// Set `det` to the determinant of the square matrix `A`.
+/// Depending on the dimensions, this calls [renf_mat_det_bareiss]() or
+/// [renf_mat_det_multimod]().
+LIBEANTIC_API void renf_mat_det(renf_elem_t det, const renf_mat_t A, renf_t nf);
+
+/// Set `det` to the determinant of the square matrix `A` computed with
+/// [renf_mat_fflu]().
+LIBEANTIC_API void renf_mat_det_bareiss(renf_elem_t det, const renf_mat_t A, renf_t nf);
+
+/// Set `det` to the determinant of the square matrix `A` computed with a
+/// multimodular algorithm.
+/// The determinant is computed modulo sufficiently many word-size primes
+/// (as for [renf_mat_mul_multimod]()) to recover it from its residues with
+/// the Chinese remainder theorem. The number of primes is determined by
+/// Hadamard's bound.
+LIBEANTIC_API void renf_mat_det_multimod(renf_elem_t det, const renf_mat_t A, renf_t nf);
+
+/// Set `X` to a solution of the linear system `A X = B` and return `1` if
+/// such a solution exists. Otherwise, return `0` and leave `X` unspecified.
+/// If the system does not have a unique solution, an arbitrary solution is
+/// returned.
+LIBEANTIC_API int renf_mat_solve(renf_mat_t X, const renf_mat_t A, const renf_mat_t B, renf_t nf);
+
+/// Set the first columns of `X` to a basis of the right kernel of `A` and
+/// return the dimension of that kernel. The matrix `X` must have as many rows
+/// and as many columns as `A` has columns. The remaining columns of `X` are
+/// set to zero.
+LIBEANTIC_API slong renf_mat_nullspace(renf_mat_t X, const renf_mat_t A, renf_t nf);
+
+/// \name Internal Functions
+/// These functions are used internally and not part of the API.
+///@{
+
+/// Recompute the enclosures of all entries of `mat` from their exact
+/// values. The arithmetic of this module works on the exact values only and
+/// calls this function once a result is complete.
+LIBEANTIC_API void _renf_mat_set_evaluation(renf_mat_t mat, const renf_t nf);
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
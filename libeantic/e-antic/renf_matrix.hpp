@@ -0,0 +1,130 @@
+/*  This is a -*- C++ -*- header file.
+
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+/// Matrices over Real Embedded Number Fields
+
+#ifndef E_ANTIC_RENF_MATRIX_HPP
+#define E_ANTIC_RENF_MATRIX_HPP
+
+#include <boost/operators.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+#include <iosfwd>
+#include <vector>
+
+#include "forward.hpp"
+#include "renf_mat.h"
+#include "renf_elem_class.hpp"
+
+namespace eantic {
+
+/// A dense matrix over a Real Embedded Number Field.
+///
+/// Unlike a `std::vector<std::vector<renf_elem_class>>`, the entries are
+/// stored in a single contiguous block of memory and the arithmetic is
+/// performed on the exact values without updating the embeddings of
+/// intermediate results.
+/// ```
+/// #include <e-antic/renf_class.hpp>
+/// #include <e-antic/renf_elem_class.hpp>
+/// #include <e-antic/renf_matrix.hpp>
+///
+/// auto K = eantic::renf_class::make("x^2 - 2", "x", "1.4 +/- 1");
+/// auto x = K->gen();
+/// eantic::renf_matrix A(*K, {{x, 1}, {2, x}});
+///
+/// std::cout << A.det();
+/// // -> 0
+///
+/// A.rank()
+/// // -> 1
+///
+/// A * A.kernel() == eantic::renf_matrix(*K, 2, 1)
+/// // -> true
+/// ```
+class LIBEANTIC_API renf_matrix : boost::equality_comparable<renf_matrix>, boost::multipliable<renf_matrix> {
+public:
+    /// Create the zero matrix with `rows` rows and `cols` columns over the
+    /// field `k`.
+    renf_matrix(const renf_class& k, size_t rows, size_t cols);
+
+    /// Create a matrix over the field `k` from its rows.
+    /// The entries must be elements of `k` or rationals. All rows must have
+    /// the same length.
+    renf_matrix(const renf_class& k, const std::vector<std::vector<renf_elem_class>>& rows);
+
+    renf_matrix(const renf_matrix&);
+    renf_matrix(renf_matrix&&) noexcept;
+
+    ~renf_matrix() noexcept;
+
+    renf_matrix& operator=(const renf_matrix&);
+    renf_matrix& operator=(renf_matrix&&) noexcept;
+
+    /// Return the `n`×`n` identity matrix over the field `k`.
+    static renf_matrix identity(const renf_class& k, size_t n);
+
+    /// Return the number of rows of this matrix.
+    size_t rows() const;
+
+    /// Return the number of columns of this matrix.
+    size_t cols() const;
+
+    /// Return the entry in row `i` and column `j`.
+    renf_elem_class operator()(size_t i, size_t j) const;
+
+    /// Set the entry in row `i` and column `j` to `value`.
+    /// The value must be an element of the field of this matrix or rational.
+    void set(size_t i, size_t j, const renf_elem_class& value);
+
+    /// Return the field over which this matrix is defined.
+    const renf_class& parent() const;
+
+    /// Replace this matrix with its product with `rhs`.
+    renf_matrix& operator*=(const renf_matrix& rhs);
+
+    /// Return the rank of this matrix.
+    size_t rank() const;
+
+    /// Return the determinant of this square matrix.
+    renf_elem_class det() const;
+
+    /// Return the reduced row echelon form of this matrix.
+    renf_matrix rref() const;
+
+    /// Return a solution `X` of `A X = b` where `A` is this matrix.
+    /// Throws an `std::invalid_argument` if there is no solution.
+    renf_matrix solve(const renf_matrix& b) const;
+
+    /// Return a matrix whose columns form a basis of the right kernel of
+    /// this matrix.
+    renf_matrix kernel() const;
+
+    /// Return a reference to the underlying [renf_mat_t]() matrix.
+    std::add_lvalue_reference_t<::renf_mat_t> renf_mat_t() const;
+
+    LIBEANTIC_API friend bool operator==(const renf_matrix&, const renf_matrix&);
+    LIBEANTIC_API friend std::ostream& operator<<(std::ostream&, const renf_matrix&);
+
+private:
+    void check(size_t i, size_t j) const;
+
+    // The field of the entries of this matrix.
+    boost::intrusive_ptr<const renf_class> nf;
+
+    // The underlying matrix. It is mutable since the C API takes non-const
+    // arguments in places where the matrix is not actually modified.
+    mutable ::renf_mat_t mat;
+};
+
+}
+
+#endif
@@ -0,0 +1,156 @@
+/// Arrays of embedded number field elements
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef E_ANTIC_RENF_SOA_H
+#define E_ANTIC_RENF_SOA_H
+
+#include "local.h"
+
+#include <flint/fmpz.h>
+#include <flint/fmpz_vec.h>
+
+#include "renf.h"
+#include "renf_elem.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// An array of elements of a single real embedded number field.
+///
+/// Unlike an array of \ref renf_elem_t, the data of the elements is not
+/// interleaved. The exact coefficients and the approximate values of the
+/// elements are stored in separate arrays ("structure of arrays"). Kernels
+/// such as sign filters, sorting, or searching for extrema, that can mostly
+/// be decided from the approximate values, only need to scan the contiguous
+/// arrays `mid` and `rad`. Only when an approximation is not good enough,
+/// the exact coefficients are consulted.
+///
+/// The attributes are not part of the API and should not be accessed directly.
+typedef struct LIBEANTIC_API renf_soa
+{
+    /// The number of elements in this array.
+    slong length;
+
+    /// The number of elements for which memory has been allocated.
+    slong alloc;
+
+    /// The number of coefficients stored for each element, i.e., the degree
+    /// of the number field.
+    slong degree;
+
+    /// The numerators of the elements written as polynomials in the generator
+    /// of the number field. The coefficients of the `i`-th element are stored
+    /// in `num[i * degree]`, …, `num[(i + 1) * degree - 1]`.
+    fmpz * num;
+
+    /// The denominators of the elements.
+    fmpz * den;
+
+    /// The midpoints of enclosures of the elements.
+    double * mid;
+
+    /// The radii of enclosures of the elements.
+    /// The `i`-th element is contained in the real interval
+    /// \f$[mid_i - rad_i, mid_i + rad_i]\f$. Where no useful enclosure is
+    /// known, the midpoint is zero and the radius is infinite.
+    double * rad;
+} renf_soa;
+
+/// An array of elements of a single real embedded number field.
+///
+/// Actually, this is an array of \ref renf_soa of length one.
+typedef renf_soa renf_soa_t[1];
+
+/// Initialize the empty array `v` of elements of the field `nf`.
+LIBEANTIC_API void renf_soa_init(renf_soa_t v, const renf_t nf);
+
+/// Deallocate the memory for `v` that was allocated with [renf_soa_init]().
+LIBEANTIC_API void renf_soa_clear(renf_soa_t v);
+
+/// Make sure that `v` has room for at least `len` elements.
+LIBEANTIC_API void renf_soa_fit_length(renf_soa_t v, slong len);
+
+/// Set the number of elements of `v` to `len`.
+/// Elements that are added by this operation are zero.
+LIBEANTIC_API void renf_soa_set_length(renf_soa_t v, slong len);
+
+/// Set the element at position `i` of `v` to `a`.
+LIBEANTIC_API void renf_soa_set_entry(renf_soa_t v, slong i, const renf_elem_t a, const renf_t nf);
+
+/// Append the element `a` to `v`.
+LIBEANTIC_API void renf_soa_push(renf_soa_t v, const renf_elem_t a, const renf_t nf);
+
+/// Set `a` to the element at position `i` of `v`.
+LIBEANTIC_API void renf_soa_get_entry(renf_elem_t a, const renf_soa_t v, slong i, renf_t nf);
+
+/// Recompute the enclosures of the elements of `v` from their exact
+/// coefficients.
+/// The evaluation uses double precision arithmetic on many elements at once
+/// and is much faster than evaluating each element with arb. The resulting
+/// enclosures are rigorous but can be rather wide for elements with large
+/// coefficients or that are very close to zero. An enclosure is only replaced
+/// if the new one is tighter.
+LIBEANTIC_API void renf_soa_set_evaluation(renf_soa_t v, renf_t nf);
+
+/// Set the signs of the elements of `v` in the array `res`.
+/// The enclosures stored in `v` decide most signs. For the remaining elements,
+/// the sign is determined exactly and the enclosures are replaced by the
+/// improved enclosures found in the process.
+LIBEANTIC_API void renf_soa_sgn(int * res, renf_soa_t v, renf_t nf);
+
+/// Return the sign of the difference of the elements at positions `i` and
+/// `j` of `v`, i.e., `-1`, `0`, or `1`.
+LIBEANTIC_API int renf_soa_cmp(renf_soa_t v, slong i, slong j, renf_t nf);
+
+/// Set `perm` to the permutation that sorts the elements of `v`
+/// in increasing order, i.e., the element `perm[0]` of `v` is the smallest
+/// element. Equal elements are ordered by their position in `v`.
+LIBEANTIC_API void renf_soa_sort(slong * perm, renf_soa_t v, renf_t nf);
+
+/// Return the position of a smallest element in `v` or `-1` if `v` is empty.
+LIBEANTIC_API slong renf_soa_min(renf_soa_t v, renf_t nf);
+
+/// Return the position of a largest element in `v` or `-1` if `v` is empty.
+LIBEANTIC_API slong renf_soa_max(renf_soa_t v, renf_t nf);
+
+/// \name Internal Functions
+/// These functions are used internally and not part of the API.
+///@{
+
+/// Set the coefficients of the element at position `i` of `v` to the ones of `a`.
+LIBEANTIC_API void _renf_soa_set_nf_elem(renf_soa_t v, slong i, const nf_elem_t a, const renf_t nf);
+
+/// Set `a` to the element whose coefficients are stored at position `i` of `v`.
+LIBEANTIC_API void _renf_soa_get_nf_elem(nf_elem_t a, const renf_soa_t v, slong i, const renf_t nf);
+
+/// Set `mid` and `rad` to a double precision enclosure of the ball `x`.
+LIBEANTIC_API void _renf_soa_enclosure_arb(double * mid, double * rad, const arb_t x);
+
+/// Set the enclosure at position `i` of `v` to an enclosure of the ball `x`.
+LIBEANTIC_API void _renf_soa_set_enclosure_arb(renf_soa_t v, slong i, const arb_t x);
+
+/// Set `mid` and `rad` to enclosures of the `len` elements given by the
+/// numerators `num` and denominators `den` (laid out as in \ref renf_soa)
+/// evaluated at the ball with midpoint `xm` and radius `xr`.
+LIBEANTIC_API void _renf_soa_evaluate_d(double * mid, double * rad, const fmpz * num, const fmpz * den, slong len, slong degree, double xm, double xr);
+
+/// Return whether the enclosures of `v` prove that the element at position
+/// `i` is smaller than the element at position `j`.
+LIBEANTIC_API int _renf_soa_certainly_lt(const renf_soa_t v, slong i, slong j);
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
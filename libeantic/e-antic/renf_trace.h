@@ -0,0 +1,149 @@
+/// Tracing of expensive operations in number fields
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef E_ANTIC_RENF_TRACE_H
+#define E_ANTIC_RENF_TRACE_H
+
+#include "local.h"
+
+#include "renf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The operations that are reported to the callback installed with
+/// [renf_set_trace]().
+typedef enum renf_trace_kind
+{
+    /// The embedding of a number field has been refined with
+    /// [renf_refine_embedding]().
+    RENF_TRACE_REFINE_EMBEDDING,
+
+    /// A predicate such as [renf_elem_sgn]() or [renf_elem_cmp]() could not
+    /// be decided from the current enclosures and recomputed them at a
+    /// higher precision.
+    RENF_TRACE_ESCALATION,
+
+    /// A number field has been created with [renf_init]() or with the
+    /// factory functions of the C++ interface.
+    RENF_TRACE_CONSTRUCTION,
+
+    /// The C++ interface looked up a newly created number field in its
+    /// registry of unique fields.
+    RENF_TRACE_REGISTRY_LOOKUP,
+
+    /// A number field has been written to a cereal archive.
+    RENF_TRACE_SERIALIZATION,
+
+    /// A number field has been read from a cereal archive.
+    RENF_TRACE_DESERIALIZATION
+} renf_trace_kind;
+
+/// An operation reported to the callback installed with [renf_set_trace]().
+typedef struct LIBEANTIC_API renf_trace_event
+{
+    /// The kind of operation.
+    renf_trace_kind kind;
+
+    /// The number field the operation was performed in.
+    const renf * nf;
+
+    /// The precision in bits before the operation. For refinements and
+    /// constructions, this is the accuracy of the embedding. For escalations,
+    /// this is the working precision of the field.
+    slong prec_before;
+
+    /// The precision in bits after the operation. For escalations, this is
+    /// the precision at which the predicate could finally be decided.
+    slong prec_after;
+
+    /// A timestamp of the start of the operation in nanoseconds.
+    /// Timestamps are monotonic but relative to an unspecified point in time.
+    ulong start;
+
+    /// The time in nanoseconds that the operation took.
+    ulong nanoseconds;
+} renf_trace_event;
+
+/// A function that is invoked with `event` for every traced operation.
+/// The argument `data` is the pointer that was given to [renf_set_trace]().
+typedef void (*renf_trace_callback)(const renf_trace_event * event, void * data);
+
+/// Install `callback` to be invoked with `data` whenever an expensive
+/// operation completes. Passing `NULL` disables tracing.
+/// When no callback is installed, tracing costs one comparison per
+/// operation.
+/// The callback might be invoked concurrently from several threads. This
+/// function is not thread-safe, so the callback should be installed before
+/// number fields are used concurrently.
+LIBEANTIC_API void renf_set_trace(renf_trace_callback callback, void * data);
+
+/// Return the callback installed with [renf_set_trace]() and set `data` to
+/// its argument if `data` is not `NULL`.
+LIBEANTIC_API renf_trace_callback renf_get_trace(void ** data);
+
+/// Return a human readable name of `kind` such as `"refine_embedding"`.
+LIBEANTIC_API const char * renf_trace_kind_name(renf_trace_kind kind);
+
+/// Start writing all traced operations to the file at `path` in the Trace
+/// Event Format of Chrome, see
+/// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU.
+/// The resulting file can be inspected in `chrome://tracing` or with
+/// Perfetto. This replaces any callback installed with [renf_set_trace]().
+/// Returns `1` if the file could be opened and `0` otherwise.
+LIBEANTIC_API int renf_trace_chrome_open(const char * path);
+
+/// Stop tracing to the file opened with [renf_trace_chrome_open]() and close
+/// the file.
+LIBEANTIC_API void renf_trace_chrome_close(void);
+
+/// \name Internal Functions
+/// These functions are used internally and not part of the API.
+///@{
+
+/// The callback installed with [renf_set_trace]() or `NULL`.
+LIBEANTIC_API extern renf_trace_callback _renf_trace_callback;
+
+/// The argument passed to [_renf_trace_callback]().
+LIBEANTIC_API extern void * _renf_trace_data;
+
+/// Return a monotonic timestamp in nanoseconds.
+LIBEANTIC_API ulong _renf_trace_now(void);
+
+/// Report an operation of `kind` in `nf` that started at `start` to the
+/// installed callback.
+LIBEANTIC_API void _renf_trace_emit(renf_trace_kind kind, const renf * nf, slong prec_before, slong prec_after, ulong start);
+
+/// Return a timestamp to pass to [_renf_trace]() when the traced operation
+/// completes, or `0` if tracing is disabled.
+static __inline__
+ulong _renf_trace_start(void)
+{
+    return _renf_trace_callback == NULL ? 0 : _renf_trace_now();
+}
+
+/// Report an operation of `kind` in `nf` that started at `start`, as
+/// returned by [_renf_trace_start](), unless tracing was disabled then.
+static __inline__
+void _renf_trace(renf_trace_kind kind, const renf * nf, slong prec_before, slong prec_after, ulong start)
+{
+    if (start != 0)
+        _renf_trace_emit(kind, nf, prec_before, prec_after, start);
+}
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
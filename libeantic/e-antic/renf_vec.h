@@ -0,0 +1,153 @@
+/// Vectors over embedded number fields with a common denominator
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef E_ANTIC_RENF_VEC_H
+#define E_ANTIC_RENF_VEC_H
+
+#include "local.h"
+
+#include <flint/fmpz.h>
+#include <flint/fmpz_vec.h>
+#include <flint/fmpq.h>
+
+#include "renf.h"
+#include "renf_elem.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// A vector of elements of a real embedded number field that share a
+/// single denominator.
+///
+/// Each entry is written as a polynomial with integer coefficients in the
+/// generator of the number field and all entries are divided by the same
+/// positive integer. Sums, scalar multiples, and dot products then only
+/// operate on integers and the denominator is only reduced once per
+/// operation instead of once per entry. No enclosures of the entries are
+/// stored; they are computed when an entry is converted with
+/// [renf_vec_get_entry]().
+///
+/// The attributes are not part of the API and should not be accessed directly.
+typedef struct LIBEANTIC_API renf_vec
+{
+    /// The number of entries of this vector.
+    slong length;
+
+    /// The number of coefficients stored for each entry, i.e., the degree
+    /// of the number field.
+    slong degree;
+
+    /// The numerators of the entries. The coefficients of the `i`-th entry
+    /// are stored in `num[i * degree]`, …, `num[(i + 1) * degree - 1]`.
+    fmpz * num;
+
+    /// The common denominator of all entries. It is positive and coprime to
+    /// the content of `num`.
+    fmpz den;
+} renf_vec;
+
+/// A vector of elements of a real embedded number field.
+///
+/// Actually, this is an array of \ref renf_vec of length one.
+typedef renf_vec renf_vec_t[1];
+
+/// Initialize `v` as the zero vector of length `len` over the field `nf`.
+/// Once done with `v`, the memory must be freed with [renf_vec_clear]().
+LIBEANTIC_API void renf_vec_init(renf_vec_t v, slong len, const renf_t nf);
+
+/// Deallocate the memory for `v` that was allocated with [renf_vec_init]().
+LIBEANTIC_API void renf_vec_clear(renf_vec_t v);
+
+/// Return the number of entries of `v`.
+static __inline__
+slong renf_vec_length(const renf_vec_t v)
+{
+    return v->length;
+}
+
+/// Swap the vectors `u` and `v`.
+static __inline__
+void renf_vec_swap(renf_vec_t u, renf_vec_t v)
+{
+    renf_vec t = *u;
+    *u = *v;
+    *v = t;
+}
+
+/// Set `u` to a copy of `v`. The vectors must have the same length.
+LIBEANTIC_API void renf_vec_set(renf_vec_t u, const renf_vec_t v);
+
+/// Set all entries of `v` to zero.
+LIBEANTIC_API void renf_vec_zero(renf_vec_t v);
+
+/// Set the entry at position `i` of `v` to `a`.
+/// Since the denominator is shared, this might rescale all other entries.
+LIBEANTIC_API void renf_vec_set_entry(renf_vec_t v, slong i, const renf_elem_t a, const renf_t nf);
+
+/// Set `a` to the entry at position `i` of `v`.
+LIBEANTIC_API void renf_vec_get_entry(renf_elem_t a, const renf_vec_t v, slong i, renf_t nf);
+
+/// Return whether all entries of `v` are zero.
+LIBEANTIC_API int renf_vec_is_zero(const renf_vec_t v);
+
+/// Return whether `u` and `v` have the same length and entries.
+LIBEANTIC_API int renf_vec_equal(const renf_vec_t u, const renf_vec_t v);
+
+/// Set `res` to the sum of `u` and `v`. All vectors must have the same length.
+LIBEANTIC_API void renf_vec_add(renf_vec_t res, const renf_vec_t u, const renf_vec_t v);
+
+/// Set `res` to the difference of `u` and `v`. All vectors must have the
+/// same length.
+LIBEANTIC_API void renf_vec_sub(renf_vec_t res, const renf_vec_t u, const renf_vec_t v);
+
+/// Set `res` to the negative of `v`.
+LIBEANTIC_API void renf_vec_neg(renf_vec_t res, const renf_vec_t v);
+
+/// Set `res` to the product of `v` with the integer `c`.
+LIBEANTIC_API void renf_vec_scalar_mul_fmpz(renf_vec_t res, const renf_vec_t v, const fmpz_t c);
+
+/// Set `res` to the product of `v` with the rational `c`.
+LIBEANTIC_API void renf_vec_scalar_mul_fmpq(renf_vec_t res, const renf_vec_t v, const fmpq_t c);
+
+/// Set `res` to the product of `v` with the number field element `a`.
+LIBEANTIC_API void renf_vec_scalar_mul(renf_vec_t res, const renf_vec_t v, const renf_elem_t a, renf_t nf);
+
+/// Set `res` to the dot product of `u` and `v`.
+/// The products of the numerators are accumulated as polynomials with
+/// integer coefficients and the sum is only reduced modulo the defining
+/// polynomial of the field once in the end.
+LIBEANTIC_API void renf_vec_dot(renf_elem_t res, const renf_vec_t u, const renf_vec_t v, renf_t nf);
+
+/// Set `res` to the positive rational multiple of `v` whose entries have
+/// integer coefficients with no common factor, i.e., the denominator of
+/// `res` is one and the content of its numerators is one unless `v` is zero.
+/// This is a normal form for the ray spanned by `v`.
+LIBEANTIC_API void renf_vec_primitive_part(renf_vec_t res, const renf_vec_t v);
+
+/// \name Internal Functions
+/// These functions are used internally and not part of the API.
+///@{
+
+/// Divide the numerators and the denominator of `v` by their greatest
+/// common divisor and make the denominator positive.
+LIBEANTIC_API void _renf_vec_canonicalise(renf_vec_t v);
+
+/// Set `a` to the entry at position `i` of `v` without its embedding.
+LIBEANTIC_API void _renf_vec_get_nf_elem(nf_elem_t a, const renf_vec_t v, slong i, const renf_t nf);
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
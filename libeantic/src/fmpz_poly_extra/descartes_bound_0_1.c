@@ -20,13 +20,75 @@
 
 #include "../../e-antic/fmpz_poly_extra.h"
 
-slong _fmpz_poly_descartes_bound_0_1(fmpz * p, slong len, slong bound)
+/* sign of a small fmpz */
+#define SMALL_SGN(x) (((x) > 0) - ((x) < 0))
+
+/* Same as the generic code below for polynomials whose coefficients stay */
+/* small during the Taylor shift. The entries of q are then small fmpz,  */
+/* i.e., plain slong values that we can add without going through fmpz. */
+static slong _fmpz_poly_descartes_bound_0_1_small(const fmpz * p, slong len, slong bound, fmpz * q)
+{
+    slong V = 0;
+    slong i, j;
+    int s, t;
+    slong deg = len - 1;
+
+    for (j = 0; j <= deg; j++)
+        fmpz_set(q + j, p + j);
+    for (j = 0; j <= deg - 1; j++)
+        q[j + 1] += q[j];
+
+    s = SMALL_SGN(q[deg]);  /* = sign(p(1)) */
+
+    for (i = 1; i <= deg - 1; i++)
+    {
+        j = deg - i;
+        t = s;
+
+        while ((j >= 0) && (t == 0))
+        {
+            t = SMALL_SGN(q[j]);
+            j--;
+        }
+
+        while ((j >= 0) && (q[j] * t >= 0))
+            j--;
+
+        if (j < 0)
+            /* all coefficients of q are non-negative */
+            return V;
+
+        for (j = 0; j <= deg - i - 1; j++)
+            q[j + 1] += q[j];
+
+        if (s == 0)
+            s = SMALL_SGN(q[deg - i]);
+        else if (s == -SMALL_SGN(q[deg - i]))
+        {
+            if (V == bound)
+                return WORD_MAX;
+            V++;
+            s = -s;
+        }
+    }
+
+    if (s == -SMALL_SGN(q[0]))
+    {
+        if (V == bound)
+            return WORD_MAX;
+        V++;
+    }
+
+    return V;
+}
+
+slong _fmpz_poly_descartes_bound_0_1_scratch(const fmpz * p, slong len, slong bound, fmpz * q)
 {
     slong V = 0;
     slong i,j;
     int s, t;
     slong deg = len - 1;
-    fmpz * q;
+    slong bits;
 
     j = deg;
     t = fmpz_sgn(p + deg);
@@ -38,7 +100,11 @@ slong _fmpz_poly_descartes_bound_0_1(fmpz * p, slong len, slong bound)
         /* all coefficients are non-negative */
         return 0;
 
-    q = _fmpz_vec_init(len);
+    /* The coefficients of q are bounded by len 2^deg max|p_i| */
+    bits = FLINT_ABS(_fmpz_vec_max_bits(p, len));
+    if (bits + deg + (slong)FLINT_BIT_COUNT(len) <= FLINT_BITS - 2)
+        return _fmpz_poly_descartes_bound_0_1_small(p, len, bound, q);
+
     fmpz_set(q, p);
     for (j = 0; j <= deg - 1; j++)
     {
@@ -64,11 +130,8 @@ slong _fmpz_poly_descartes_bound_0_1(fmpz * p, slong len, slong bound)
             j--;
 
         if (j < 0)
-        {
             /* all coefficients of q are non-negative */
-            _fmpz_vec_clear(q, len);
             return V;
-        }
 
         for (j = 0; j <= deg - i - 1; j++)
             fmpz_add(q + j + 1, q + j + 1, q + j);
@@ -78,10 +141,7 @@ slong _fmpz_poly_descartes_bound_0_1(fmpz * p, slong len, slong bound)
         else if (s == -fmpz_sgn(q + deg - i))
         {
             if (V == bound)
-            {
-                _fmpz_vec_clear(q, len);
                 return WORD_MAX;
-            }
             V++;
             s = -s;
         }
@@ -90,15 +150,21 @@ slong _fmpz_poly_descartes_bound_0_1(fmpz * p, slong len, slong bound)
     if (s == -fmpz_sgn(q))
     {
         if (V == bound)
-        {
-            _fmpz_vec_clear(q, len);
             return WORD_MAX;
-        }
         V++;
     }
 
-    _fmpz_vec_clear(q, len);
     return V;
 }
 
+slong _fmpz_poly_descartes_bound_0_1(fmpz * p, slong len, slong bound)
+{
+    slong V;
+    fmpz * q;
 
+    q = _fmpz_vec_init(len);
+    V = _fmpz_poly_descartes_bound_0_1_scratch(p, len, bound, q);
+    _fmpz_vec_clear(q, len);
+
+    return V;
+}
@@ -10,11 +10,26 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <flint/ulong_extras.h>
+
 #include "../../e-antic/config.h"
 
 #include "../../e-antic/fmpz_poly_extra.h"
 
+/* Below this length, Horner's rule is used. Rectangular splitting replaces */
+/* most of the multiplications by a with multiplications by the integral    */
+/* coefficients in a dot product which pays off earlier at high precision.  */
+#define EVALUATE_RECTANGULAR_CUTOFF(prec) ((prec) <= 256 ? 24 : 8)
+
 void _fmpz_poly_evaluate_arb(arb_t res, const fmpz * pol, mp_limb_signed_t len, const arb_t a, mp_limb_signed_t prec)
+{
+    if (len < EVALUATE_RECTANGULAR_CUTOFF(prec))
+        _fmpz_poly_evaluate_arb_horner(res, pol, len, a, prec);
+    else
+        _fmpz_poly_evaluate_arb_rectangular(res, pol, len, a, prec);
+}
+
+void _fmpz_poly_evaluate_arb_horner(arb_t res, const fmpz * pol, mp_limb_signed_t len, const arb_t a, mp_limb_signed_t prec)
 {
     mp_limb_signed_t i;
 
@@ -26,6 +41,43 @@ void _fmpz_poly_evaluate_arb(arb_t res, const fmpz * pol, mp_limb_signed_t len,
     }
 }
 
+void _fmpz_poly_evaluate_arb_rectangular(arb_t res, const fmpz * pol, mp_limb_signed_t len, const arb_t a, mp_limb_signed_t prec)
+{
+    mp_limb_signed_t i, m, r;
+    arb_ptr xs;
+    arb_t s, t;
+
+    if (len <= 2)
+    {
+        _fmpz_poly_evaluate_arb_horner(res, pol, len, a, prec);
+        return;
+    }
+
+    /* split pol into r blocks of length m and evaluate each block as a */
+    /* dot product with the powers 1, a, ..., a^(m-1)                    */
+    m = (mp_limb_signed_t) n_sqrt((ulong) len) + 1;
+    r = (len + m - 1) / m;
+
+    xs = _arb_vec_init(m + 1);
+    arb_init(s);
+    arb_init(t);
+
+    _arb_vec_set_powers(xs, a, m + 1, prec);
+
+    arb_dot_fmpz(s, NULL, 0, xs, 1, pol + (r - 1) * m, 1, len - (r - 1) * m, prec);
+    for (i = r - 2; i >= 0; i--)
+    {
+        arb_mul(t, s, xs + m, prec);
+        arb_dot_fmpz(s, t, 0, xs, 1, pol + i * m, 1, m, prec);
+    }
+
+    arb_swap(res, s);
+
+    _arb_vec_clear(xs, m + 1);
+    arb_clear(s);
+    arb_clear(t);
+}
+
 void fmpz_poly_evaluate_arb(arb_t res, const fmpz_poly_t pol, const arb_t a, mp_limb_signed_t prec)
 {
     if (a == res)
@@ -48,6 +100,23 @@ void _fmpz_poly_evaluate_arf(arf_t res, const fmpz * pol, mp_limb_signed_t len,
 {
     mp_limb_signed_t i;
 
+    if (len >= EVALUATE_RECTANGULAR_CUTOFF(prec))
+    {
+        /* evaluate at the exact ball a and round the midpoint */
+        arb_t x, y;
+
+        arb_init(x);
+        arb_init(y);
+
+        arb_set_arf(x, a);
+        _fmpz_poly_evaluate_arb_rectangular(y, pol, len, x, prec);
+        arf_set_round(res, arb_midref(y), prec, ARF_RND_NEAR);
+
+        arb_clear(x);
+        arb_clear(y);
+        return;
+    }
+
     arf_zero(res);
     for (i = len - 1; i >= 0; i--)
     {
@@ -14,6 +14,7 @@
 
 #include <flint/fmpz_vec.h>
 #include <flint/fmpq.h>
+#include <flint/fmpq_vec.h>
 
 #include "../../e-antic/config.h"
 
@@ -34,6 +35,7 @@ void _fmpz_poly_isolate_real_roots_0_1_vca(fmpq * exact_roots, slong * n_exact,
     slong k;
     fmpz * p;
     fmpz * p0;
+    fmpz * scratch;
     slong i;
     fmpz_t one;
     slong len0 = len;
@@ -42,6 +44,7 @@ void _fmpz_poly_isolate_real_roots_0_1_vca(fmpq * exact_roots, slong * n_exact,
     fmpz_one(one);
     p0 = p = _fmpz_vec_init(len);
     _fmpz_vec_set(p, pol, len);
+    scratch = _fmpz_vec_init(len);
 
     fmpz_init(c);
     fmpz_zero(c);
@@ -67,7 +70,7 @@ void _fmpz_poly_isolate_real_roots_0_1_vca(fmpq * exact_roots, slong * n_exact,
 
         /* use Descartes bound */
         {
-            const slong bound = _fmpz_poly_descartes_bound_0_1(p, len, 2);
+            const slong bound = _fmpz_poly_descartes_bound_0_1_scratch(p, len, 2, scratch);
             switch(bound)
             {
                 case 2:
@@ -101,6 +104,7 @@ void _fmpz_poly_isolate_real_roots_0_1_vca(fmpq * exact_roots, slong * n_exact,
                 fmpz_clear(c);
                 fmpz_clear(one);
                 _fmpz_vec_clear(p0, len0);
+                _fmpz_vec_clear(scratch, len0);
                 return;
             }
 
@@ -118,10 +122,54 @@ void _fmpz_poly_isolate_real_roots_0_1_vca(fmpq * exact_roots, slong * n_exact,
     }
 }
 
+/* Above this length, VCA works with ball approximations of the coefficients
+ * since exact Taylor shifts get too expensive. The initial precision accounts
+ * for the bits lost in a shift. */
+#define ISOLATE_REAL_ROOTS_ARB_CUTOFF 100
+
+/* isolate the roots in (0,1) with the given method */
+static void isolate_real_roots_0_1(int method, fmpq * exact_roots, slong * n_exact, fmpz * c_array, slong * k_array, slong * n_interval, fmpz * pol, slong len)
+{
+    if (method == FMPZ_POLY_ISOLATE_REAL_ROOTS_VAS)
+        _fmpz_poly_isolate_real_roots_0_1_vas(exact_roots, n_exact, c_array, k_array, n_interval, pol, len);
+    else if (len > ISOLATE_REAL_ROOTS_ARB_CUTOFF)
+        _fmpz_poly_isolate_real_roots_0_1_arb(exact_roots, n_exact, c_array, k_array, n_interval, pol, len, 64 + len);
+    else
+        _fmpz_poly_isolate_real_roots_0_1_vca(exact_roots, n_exact, c_array, k_array, n_interval, pol, len);
+}
+
+/* Below this length, the overhead of distributing the work to threads is
+ * not worth it. */
+#define ISOLATE_REAL_ROOTS_THREADED_CUTOFF 32
+
 void fmpz_poly_isolate_real_roots(fmpq * exact_roots, slong * n_exact, fmpz * c_array, slong * k_array, slong * n_interval, fmpz_poly_t pol)
 {
-    slong i, k, n_neg, tmp, len, n_zeros, n_neg_exact;
+    slong thread_limit = 1;
+
+    if (pol->length >= ISOLATE_REAL_ROOTS_THREADED_CUTOFF)
+        thread_limit = flint_get_num_threads();
+
+    fmpz_poly_isolate_real_roots_threaded(exact_roots, n_exact, c_array, k_array, n_interval, pol, thread_limit);
+}
+
+void fmpz_poly_isolate_real_roots_threaded(fmpq * exact_roots, slong * n_exact, fmpz * c_array, slong * k_array, slong * n_interval, fmpz_poly_t pol, slong thread_limit)
+{
+    slong i, k, k_pos, n_neg, tmp, len, n_zeros, n_neg_exact;
     fmpz * p;
+    fmpz * p_pos;
+
+    /* When running in parallel, the roots of the positive half-line are
+     * collected here and moved into place once the number of negative roots
+     * is known. */
+    fmpq * pos_exact_roots = NULL;
+    fmpz * pos_c_array = NULL;
+    slong * pos_k_array = NULL;
+    slong pos_n_exact = 0;
+    slong pos_n_interval = 0;
+
+    /* only the VCA method can distribute its work to threads */
+    const int method = fmpz_poly_isolate_real_roots_get_method();
+    const int threaded = thread_limit > 1 && method == FMPZ_POLY_ISOLATE_REAL_ROOTS_VCA;
 
     n_neg = n_zeros = n_neg_exact = *n_exact = *n_interval = 0;
     len = pol->length;
@@ -139,14 +187,63 @@ void fmpz_poly_isolate_real_roots(fmpq * exact_roots, slong * n_exact, fmpz * c_
     p = _fmpz_vec_init(len);
     _fmpz_vec_set(p, pol->coeffs + n_zeros, len);
 
+    /* positive roots are isolated on P(2^k x) */
+    p_pos = _fmpz_vec_init(len);
+    _fmpz_vec_set(p_pos, pol->coeffs + n_zeros, len);
+    k_pos = _fmpz_poly_positive_root_upper_bound_2exp(p_pos, len);
+    if (k_pos != WORD_MIN)
+        _fmpz_poly_scale_2exp(p_pos, len, k_pos);
+
     /* negative roots (use P(-x)) */
     for (i = 1; i < len; i += 2) fmpz_neg(p + i, p + i);
     k = _fmpz_poly_positive_root_upper_bound_2exp(p, len);
+    if (k != WORD_MIN)
+        _fmpz_poly_scale_2exp(p, len, k);
+
+    if (threaded)
+    {
+        /* isolate the roots on both half-lines concurrently */
+        fmpq * exact_roots_all[2];
+        fmpz * c_array_all[2];
+        slong * k_array_all[2];
+        slong n_exact_all[2] = {0, 0};
+        slong n_interval_all[2] = {0, 0};
+        fmpz * pols[2];
+        slong lens[2];
+
+        if (exact_roots != NULL)
+            pos_exact_roots = _fmpq_vec_init(len);
+        if ((c_array != NULL) && (k_array != NULL))
+        {
+            pos_c_array = _fmpz_vec_init(len);
+            pos_k_array = (slong *) flint_malloc(len * sizeof(slong));
+        }
+
+        exact_roots_all[0] = exact_roots;
+        exact_roots_all[1] = pos_exact_roots;
+        c_array_all[0] = c_array;
+        c_array_all[1] = pos_c_array;
+        k_array_all[0] = k_array;
+        k_array_all[1] = pos_k_array;
+        pols[0] = p;
+        pols[1] = p_pos;
+        lens[0] = k == WORD_MIN ? 0 : len;
+        lens[1] = k_pos == WORD_MIN ? 0 : len;
+
+        _fmpz_poly_isolate_real_roots_0_1_vca_threaded(exact_roots_all, n_exact_all, c_array_all, k_array_all, n_interval_all, pols, lens, 2, thread_limit);
+
+        *n_exact = n_exact_all[0];
+        *n_interval = n_interval_all[0];
+        pos_n_exact = n_exact_all[1];
+        pos_n_interval = n_interval_all[1];
+    }
+    else if (k != WORD_MIN)
+    {
+        isolate_real_roots_0_1(method, exact_roots, n_exact, c_array, k_array, n_interval, p, len);
+    }
 
     if (k != WORD_MIN)
     {
-        _fmpz_poly_scale_2exp(p, len, k);
-        _fmpz_poly_isolate_real_roots_0_1_vca(exact_roots, n_exact, c_array, k_array, n_interval, p, len);
         n_neg = *n_interval;
         n_neg_exact = *n_exact;
         if ((c_array != NULL) && (k_array != NULL))
@@ -194,12 +291,29 @@ void fmpz_poly_isolate_real_roots(fmpq * exact_roots, slong * n_exact, fmpz * c_
 
 
     /* positive roots */
-    _fmpz_vec_set(p, pol->coeffs + n_zeros, len);
-    k = _fmpz_poly_positive_root_upper_bound_2exp(p, len);
+    k = k_pos;
     if (k != WORD_MIN)
     {
-        _fmpz_poly_scale_2exp(p, len, k);
-        _fmpz_poly_isolate_real_roots_0_1_vca(exact_roots, n_exact, c_array, k_array, n_interval, p, len);
+        if (threaded)
+        {
+            if (exact_roots != NULL)
+                for (i = 0; i < pos_n_exact; i++)
+                    fmpq_swap(exact_roots + *n_exact + i, pos_exact_roots + i);
+            if ((c_array != NULL) && (k_array != NULL))
+            {
+                for (i = 0; i < pos_n_interval; i++)
+                {
+                    fmpz_swap(c_array + *n_interval + i, pos_c_array + i);
+                    k_array[*n_interval + i] = pos_k_array[i];
+                }
+            }
+            *n_exact += pos_n_exact;
+            *n_interval += pos_n_interval;
+        }
+        else
+        {
+            isolate_real_roots_0_1(method, exact_roots, n_exact, c_array, k_array, n_interval, p_pos, len);
+        }
 
         if ((c_array != NULL) && (k_array != NULL))
         {
@@ -219,8 +333,14 @@ void fmpz_poly_isolate_real_roots(fmpq * exact_roots, slong * n_exact, fmpz * c_
         }
     }
 
+    if (pos_exact_roots != NULL)
+        _fmpq_vec_clear(pos_exact_roots, len);
+    if (pos_c_array != NULL)
+    {
+        _fmpz_vec_clear(pos_c_array, len);
+        flint_free(pos_k_array);
+    }
 
     _fmpz_vec_clear(p, len);
+    _fmpz_vec_clear(p_pos, len);
 }
-
-
@@ -0,0 +1,309 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <flint/fmpz_vec.h>
+#include <flint/fmpq.h>
+
+#if __FLINT_RELEASE < 30000
+#include <arb_poly.h>
+#else
+#include <flint/arb_poly.h>
+#endif
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+/* A variant of VCA that works with ball approximations of the coefficients  */
+/* (in the spirit of the bitstream Descartes method). The polynomial of each */
+/* node of the subdivision tree is computed from the polynomial of its       */
+/* parent with arb arithmetic. As long as the signs of the coefficients that */
+/* enter Descartes' rule are certified, the decisions are the same as with   */
+/* exact arithmetic. Otherwise, the polynomial of the node is recomputed     */
+/* exactly from the input and the working precision of the subtree is        */
+/* doubled.                                                                  */
+/*                                                                           */
+/* To take the same decisions as _fmpz_poly_isolate_real_roots_0_1_vca, we   */
+/* treat exact roots the same way: a root is divided out of the working      */
+/* polynomial once the traversal reaches the node whose left endpoint it is. */
+/* All the nodes that are processed later, including the ones that are       */
+/* already on the stack, are then recomputed from the divided polynomial.    */
+/* Roots at the right endpoint of a node are never divided out; the          */
+/* corresponding coefficient in Descartes' rule is known to vanish.          */
+
+typedef struct
+{
+    arb_ptr pol;
+    slong alloc;
+    slong len;
+    fmpz_t c;
+    slong k;
+    slong prec;
+    /* whether c 2^-k is a root that has not been reported yet */
+    int root;
+    /* whether (c + 1) 2^-k is a root */
+    int right_root;
+    /* the number of exact roots that had been divided out of the working */
+    /* polynomial when pol was computed */
+    slong divided;
+}
+vca_arb_node_struct;
+
+static void vca_arb_node_init(vca_arb_node_struct * node, slong len, slong prec)
+{
+    node->pol = _arb_vec_init(len);
+    node->alloc = node->len = len;
+    fmpz_init(node->c);
+    node->k = 0;
+    node->prec = prec;
+    node->root = 0;
+    node->right_root = 0;
+    node->divided = 0;
+}
+
+static void vca_arb_node_clear(vca_arb_node_struct * node)
+{
+    _arb_vec_clear(node->pol, node->alloc);
+    fmpz_clear(node->c);
+}
+
+/* Return the number of sign variations of the coefficients of             */
+/* (1 + x)^n pol(1 / (1 + x)) if it is 0 or 1, return 2 if it is at least 2 */
+/* and -1 if the signs of the coefficients cannot be certified.            */
+static slong vca_arb_descartes_bound_0_1(const vca_arb_node_struct * node)
+{
+    slong i, v = 0;
+    int s = 0, t, uncertain = 0;
+    arb_ptr q;
+    arb_t one;
+
+    q = _arb_vec_init(node->len);
+    arb_init(one);
+    arb_one(one);
+
+    for (i = 0; i < node->len; i++)
+        arb_set(q + i, node->pol + node->len - 1 - i);
+    _arb_poly_taylor_shift(q, one, node->len, node->prec);
+
+    /* the constant coefficient is pol(1) which vanishes at a right root */
+    for (i = node->right_root; i < node->len && v < 2; i++)
+    {
+        if (arb_is_positive(q + i))
+            t = 1;
+        else if (arb_is_negative(q + i))
+            t = -1;
+        else
+        {
+            uncertain = 1;
+            continue;
+        }
+
+        if (s != 0 && t != s)
+            v++;
+        s = t;
+    }
+
+    _arb_vec_clear(q, node->len);
+    arb_clear(one);
+
+    /* ignoring coefficients of unknown sign can only lower the count */
+    if (v < 2 && uncertain)
+        return -1;
+    return v;
+}
+
+/* Recompute the polynomial of the node exactly from the working polynomial */
+/* (pol, len) at the precision of the node. If bound is non-zero, return    */
+/* the Descartes bound of the exact polynomial of the node.                 */
+static slong vca_arb_node_set(vca_arb_node_struct * node, const fmpz * pol, slong len, slong divided, int bound)
+{
+    slong i, v = 0;
+    fmpz * p;
+
+    p = _fmpz_vec_init(len);
+    _fmpz_vec_set(p, pol, len);
+
+    /* pol((x + c) / 2^k) */
+    _fmpz_poly_scale_2exp(p, len, -node->k);
+    _fmpz_poly_taylor_shift(p, node->c, len);
+
+    _arb_vec_clear(node->pol, node->alloc);
+    node->pol = _arb_vec_init(len);
+    node->alloc = node->len = len;
+    for (i = 0; i < len; i++)
+        arb_set_round_fmpz(node->pol + i, p + i, node->prec);
+    node->divided = divided;
+
+    if (bound && len > 1)
+        v = FLINT_MIN(2, _fmpz_poly_descartes_bound_0_1(p, len, 2));
+
+    _fmpz_vec_clear(p, len);
+
+    return v;
+}
+
+static void vca_arb_push(vca_arb_node_struct ** stack, slong * depth, slong * alloc, const vca_arb_node_struct * node)
+{
+    if (*depth == *alloc)
+    {
+        *alloc = FLINT_MAX(16, 2 * *alloc);
+        *stack = (vca_arb_node_struct *) flint_realloc(*stack, (ulong)*alloc * sizeof(vca_arb_node_struct));
+    }
+    (*stack)[(*depth)++] = *node;
+}
+
+void _fmpz_poly_isolate_real_roots_0_1_arb(fmpq * exact_roots, slong * n_exact,
+        fmpz * c_array, slong * k_array, slong * n_intervals,
+        fmpz * pol, slong len, slong prec)
+{
+    vca_arb_node_struct * stack = NULL;
+    slong depth = 0, alloc = 0, divided = 0;
+    vca_arb_node_struct node, right;
+    slong i, v;
+    fmpz_poly_t p, x_minus_root;
+    fmpz_t num, den, t;
+    arb_t one;
+
+    /* exact roots at zero */
+    while (len && fmpz_is_zero(pol))
+    {
+        if (exact_roots != NULL)
+            fmpq_zero(exact_roots + *n_exact);
+        (*n_exact)++;
+        pol++;
+        len--;
+    }
+
+    if (len <= 1)
+        return;
+
+    fmpz_init(num);
+    fmpz_init(den);
+    fmpz_init(t);
+    arb_init(one);
+    arb_one(one);
+
+    /* the working polynomial that exact roots are divided out of */
+    fmpz_poly_init2(p, len);
+    fmpz_poly_init2(x_minus_root, 2);
+    _fmpz_vec_set(p->coeffs, pol, len);
+    _fmpz_poly_set_length(p, len);
+
+    vca_arb_node_init(&node, len, prec);
+    vca_arb_node_set(&node, p->coeffs, p->length, divided, 0);
+
+    /* roots at one are neither reported nor divided out */
+    fmpz_poly_evaluate_at_one(t, p->coeffs, p->length);
+    node.right_root = fmpz_is_zero(t);
+
+    vca_arb_push(&stack, &depth, &alloc, &node);
+
+    while (depth)
+    {
+        node = stack[--depth];
+
+        if (node.root)
+        {
+            /* c 2^-k is a root of p, report it and divide it out */
+            fmpz_one(den);
+            fmpz_mul_2exp(den, den, (ulong)node.k);
+            fmpz_poly_set_coeff_fmpz(x_minus_root, 1, den);
+            fmpz_neg(t, node.c);
+            fmpz_poly_set_coeff_fmpz(x_minus_root, 0, t);
+
+            do
+            {
+                if (exact_roots != NULL)
+                    fmpq_set_fmpz_frac(exact_roots + *n_exact, node.c, den);
+                (*n_exact)++;
+
+                fmpz_poly_div(p, p, x_minus_root);
+                divided++;
+
+                _fmpz_poly_evaluate_fmpq(num, t, p->coeffs, p->length, node.c, den);
+            }
+            while (p->length > 1 && fmpz_is_zero(num));
+
+            node.root = 0;
+        }
+
+        /* the node has been computed before exact roots were divided out */
+        if (node.divided != divided)
+            vca_arb_node_set(&node, p->coeffs, p->length, divided, 0);
+
+        v = node.len <= 1 ? 0 : vca_arb_descartes_bound_0_1(&node);
+        if (v < 0)
+        {
+            node.prec *= 2;
+            v = vca_arb_node_set(&node, p->coeffs, p->length, divided, 1);
+        }
+
+        if (v == 0)
+        {
+            vca_arb_node_clear(&node);
+            continue;
+        }
+
+        if (v == 1)
+        {
+            if ((c_array != NULL) && (k_array != NULL))
+            {
+                fmpz_set(c_array + *n_intervals, node.c);
+                k_array[*n_intervals] = -node.k;
+            }
+            (*n_intervals)++;
+            vca_arb_node_clear(&node);
+            continue;
+        }
+
+        /* left child: pol(x / 2), right child: pol((x + 1) / 2) */
+        for (i = 1; i < node.len; i++)
+            arb_mul_2exp_si(node.pol + i, node.pol + i, -i);
+
+        vca_arb_node_init(&right, node.len, node.prec);
+        _arb_vec_set(right.pol, node.pol, node.len);
+        _arb_poly_taylor_shift(right.pol, one, right.len, right.prec);
+        fmpz_mul_2exp(right.c, node.c, 1);
+        fmpz_add_ui(right.c, right.c, 1);
+        right.k = node.k + 1;
+        right.right_root = node.right_root;
+        right.divided = divided;
+
+        fmpz_mul_2exp(node.c, node.c, 1);
+        node.k++;
+        node.right_root = 0;
+
+        /* check whether the midpoint is a root */
+        if (arb_contains_zero(right.pol))
+        {
+            fmpz_one(den);
+            fmpz_mul_2exp(den, den, (ulong)right.k);
+            _fmpz_poly_evaluate_fmpq(num, t, p->coeffs, p->length, right.c, den);
+
+            if (fmpz_is_zero(num))
+            {
+                right.root = 1;
+                node.right_root = 1;
+            }
+        }
+
+        vca_arb_push(&stack, &depth, &alloc, &right);
+        vca_arb_push(&stack, &depth, &alloc, &node);
+    }
+
+    flint_free(stack);
+    fmpz_poly_clear(p);
+    fmpz_poly_clear(x_minus_root);
+    fmpz_clear(num);
+    fmpz_clear(den);
+    fmpz_clear(t);
+    arb_clear(one);
+}
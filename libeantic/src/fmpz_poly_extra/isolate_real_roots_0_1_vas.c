@@ -0,0 +1,568 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <flint/fmpz_vec.h>
+#include <flint/fmpq.h>
+#include <flint/fmpq_vec.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+/* Isolate the real roots in (0,1) with the continued fraction method of    */
+/* Vincent, Akritas and Strzebonski (VAS).                                  */
+/*                                                                          */
+/* Each node of the search tree is a polynomial q together with a Moebius   */
+/* transformation x = (a y + b) / (c y + d) with nonnegative coefficients   */
+/* such that the roots of q in (0,oo) correspond to the roots of pol in the */
+/* interval between M(0) = b/d and M(oo) = a/c. Instead of bisecting, a     */
+/* lower bound on the positive roots of q is used to jump over the part of  */
+/* the interval that contains no roots. This is much faster than VCA when   */
+/* roots are clustered.                                                     */
+/*                                                                          */
+/* The resulting intervals have rational endpoints. They are then turned    */
+/* into dyadic intervals (c 2^k, (c+1) 2^k) as VCA produces them.           */
+
+typedef struct
+{
+    fmpz * pol;
+    slong alloc;
+    slong len;
+    fmpz_t a, b, c, d;
+}
+vas_node_struct;
+
+/* The roots found by the search. Exact roots have left == right and sgn 0. */
+/* Otherwise, pol has a single root in (left, right) and sgn is the sign of */
+/* pol on the left of that root.                                            */
+typedef struct
+{
+    fmpq * left;
+    fmpq * right;
+    int * sgn;
+    slong length;
+}
+vas_roots_struct;
+
+static void vas_node_init(vas_node_struct * node, slong len)
+{
+    node->pol = _fmpz_vec_init(len);
+    node->alloc = node->len = len;
+    fmpz_init(node->a);
+    fmpz_init(node->b);
+    fmpz_init(node->c);
+    fmpz_init(node->d);
+}
+
+static void vas_node_clear(vas_node_struct * node)
+{
+    _fmpz_vec_clear(node->pol, node->alloc);
+    fmpz_clear(node->a);
+    fmpz_clear(node->b);
+    fmpz_clear(node->c);
+    fmpz_clear(node->d);
+}
+
+static void vas_record_exact(vas_roots_struct * roots, const fmpz_t num, const fmpz_t den)
+{
+    fmpq_set_fmpz_frac(roots->left + roots->length, num, den);
+    fmpq_set(roots->right + roots->length, roots->left + roots->length);
+    roots->sgn[roots->length] = 0;
+    roots->length++;
+}
+
+static void vas_record_interval(vas_roots_struct * roots, const vas_node_struct * node)
+{
+    fmpq * left = roots->left + roots->length;
+    fmpq * right = roots->right + roots->length;
+
+    fmpq_set_fmpz_frac(left, node->b, node->d);
+    fmpq_set_fmpz_frac(right, node->a, node->c);
+
+    /* the sign of pol at M(y) is the sign of q(y) */
+    if (fmpq_cmp(left, right) < 0)
+    {
+        roots->sgn[roots->length] = fmpz_sgn(node->pol);
+    }
+    else
+    {
+        fmpq_swap(left, right);
+        roots->sgn[roots->length] = fmpz_sgn(node->pol + node->len - 1);
+    }
+
+    roots->length++;
+}
+
+/* Divide q by y as long as q(0) = 0. The corresponding root M(0) of pol is */
+/* recorded if roots is not NULL.                                           */
+static void vas_strip(vas_roots_struct * roots, vas_node_struct * node)
+{
+    slong i;
+
+    while (node->len && fmpz_is_zero(node->pol))
+    {
+        if (roots != NULL)
+            vas_record_exact(roots, node->b, node->d);
+
+        for (i = 0; i + 1 < node->len; i++)
+            fmpz_swap(node->pol + i, node->pol + i + 1);
+        node->len--;
+    }
+}
+
+/* Return the number of sign variations of (p, len) or bound if there are */
+/* at least bound variations.                                             */
+static slong vas_sign_variations(const fmpz * p, slong len, slong bound)
+{
+    slong i, v = 0;
+    int s = 0, t;
+
+    for (i = 0; i < len; i++)
+    {
+        t = fmpz_sgn(p + i);
+        if (t == 0)
+            continue;
+        if (s != 0 && t != s && ++v == bound)
+            return v;
+        s = t;
+    }
+
+    return v;
+}
+
+/* Substitute y by y + 2^s or, if s is large, scale y by 2^s and then shift */
+/* by one. In both cases, no positive roots are lost if 2^s is a lower bound */
+/* for the positive roots of q.                                             */
+static void vas_shift(vas_node_struct * node, slong s)
+{
+    fmpz_t t;
+
+    fmpz_init(t);
+
+    if (s >= 4)
+    {
+        _fmpz_poly_scale_2exp(node->pol, node->len, s);
+        fmpz_mul_2exp(node->a, node->a, (ulong)s);
+        fmpz_mul_2exp(node->c, node->c, (ulong)s);
+        fmpz_one(t);
+    }
+    else
+    {
+        fmpz_one(t);
+        fmpz_mul_2exp(t, t, (ulong)s);
+    }
+
+    _fmpz_poly_taylor_shift(node->pol, t, node->len);
+    fmpz_addmul(node->b, node->a, t);
+    fmpz_addmul(node->d, node->c, t);
+
+    fmpz_clear(t);
+}
+
+static void vas_push(vas_node_struct ** stack, slong * depth, slong * alloc, const vas_node_struct * node)
+{
+    if (*depth == *alloc)
+    {
+        *alloc = FLINT_MAX(16, 2 * *alloc);
+        *stack = (vas_node_struct *) flint_realloc(*stack, (ulong)*alloc * sizeof(vas_node_struct));
+    }
+    (*stack)[(*depth)++] = *node;
+}
+
+/* Run the continued fraction search on the polynomial (pol, len) without */
+/* roots at 0. The roots in (0,1) are stored in roots.                    */
+static void vas_search(vas_roots_struct * roots, const fmpz * pol, slong len)
+{
+    vas_node_struct * stack = NULL;
+    slong depth = 0, alloc = 0;
+    vas_node_struct node, left;
+    slong v, k;
+    fmpz * rev;
+    fmpz_t one;
+
+    fmpz_init(one);
+    fmpz_one(one);
+    rev = _fmpz_vec_init(len);
+
+    /* (1 + y)^n pol(1 / (1 + y)) has its positive roots corresponding to */
+    /* the roots of pol in (0,1)                                          */
+    vas_node_init(&node, len);
+    _fmpz_poly_reverse(node.pol, pol, len, len);
+    _fmpz_poly_taylor_shift(node.pol, one, len);
+    fmpz_zero(node.a);
+    fmpz_one(node.b);
+    fmpz_one(node.c);
+    fmpz_one(node.d);
+
+    /* a root at 1 is not in (0,1) */
+    vas_strip(NULL, &node);
+    vas_push(&stack, &depth, &alloc, &node);
+
+    while (depth)
+    {
+        node = stack[--depth];
+
+        v = vas_sign_variations(node.pol, node.len, 2);
+
+        if (v == 2)
+        {
+            /* the positive roots of q are larger than the inverse of the */
+            /* largest positive root of the reversed polynomial           */
+            _fmpz_poly_reverse(rev, node.pol, node.len, node.len);
+            k = _fmpz_poly_positive_root_upper_bound_2exp(rev, node.len);
+
+            if (k != WORD_MIN && k <= 0)
+            {
+                vas_shift(&node, -k);
+                vas_strip(roots, &node);
+                v = vas_sign_variations(node.pol, node.len, 2);
+            }
+        }
+
+        if (v == 0)
+        {
+            vas_node_clear(&node);
+        }
+        else if (v == 1)
+        {
+            vas_record_interval(roots, &node);
+            vas_node_clear(&node);
+        }
+        else
+        {
+            /* roots in (0,1) become the positive roots of */
+            /* (1 + y)^n q(1 / (1 + y))                    */
+            vas_node_init(&left, node.len);
+            _fmpz_poly_reverse(left.pol, node.pol, node.len, node.len);
+            _fmpz_poly_taylor_shift(left.pol, one, node.len);
+            fmpz_set(left.a, node.b);
+            fmpz_add(left.b, node.a, node.b);
+            fmpz_set(left.c, node.d);
+            fmpz_add(left.d, node.c, node.d);
+
+            /* roots in (1,oo) become the positive roots of q(y + 1) */
+            _fmpz_poly_taylor_shift(node.pol, one, node.len);
+            fmpz_add(node.b, node.a, node.b);
+            fmpz_add(node.d, node.c, node.d);
+
+            /* a root at 1 is recorded only once */
+            vas_strip(roots, &node);
+            vas_strip(NULL, &left);
+
+            vas_push(&stack, &depth, &alloc, &node);
+            vas_push(&stack, &depth, &alloc, &left);
+        }
+    }
+
+    flint_free(stack);
+    _fmpz_vec_clear(rev, len);
+    fmpz_clear(one);
+}
+
+/* Return the sign of (pol, len) at u / 2^j. */
+static int vas_sgn_dyadic(const fmpz * pol, slong len, const fmpz_t u, slong j)
+{
+    int s;
+    fmpz_t num, den, t;
+
+    fmpz_init(num);
+    fmpz_init(den);
+    fmpz_init(t);
+
+    fmpz_one(t);
+    fmpz_mul_2exp(t, t, (ulong)j);
+    _fmpz_poly_evaluate_fmpq(num, den, pol, len, u, t);
+    s = fmpz_sgn(num);
+
+    fmpz_clear(num);
+    fmpz_clear(den);
+    fmpz_clear(t);
+
+    return s;
+}
+
+/* Shrink the interval (left, right) containing a single root of (pol, len) */
+/* until it is of the form (u 2^-j, (u+1) 2^-j) with j >= jmin. Returns 1   */
+/* and sets left to the root instead if the root turns out to be dyadic.    */
+/* Since a dyadic root of pol has a denominator that divides its leading    */
+/* coefficient, every dyadic root is found if 2^jmin is the largest power   */
+/* of two dividing the leading coefficient.                                 */
+static int vas_dyadic_interval(fmpz_t u, slong * j, fmpq_t left, fmpq_t right, int sgn, const fmpz * pol, slong len, slong jmin)
+{
+    int s, left_dyadic = 0, right_dyadic = 0;
+    slong jl, jr;
+    fmpz_t v, m;
+    fmpq_t t;
+
+    fmpz_init(v);
+    fmpz_init(m);
+    fmpq_init(t);
+
+    /* bisect at dyadic points close to the midpoint until both endpoints */
+    /* are dyadic                                                         */
+    while (!left_dyadic || !right_dyadic)
+    {
+        fmpq_sub(t, right, left);
+        *j = FLINT_MAX(0, (slong)fmpz_bits(fmpq_denref(t)) - (slong)fmpz_bits(fmpq_numref(t)) + 3);
+
+        /* the dyadic point m 2^-j below the midpoint lies in (left, right) */
+        /* since 2^-j is at most a quarter of the width                     */
+        fmpq_add(t, left, right);
+        fmpq_mul_2exp(t, t, (ulong)*j);
+        fmpq_div_2exp(t, t, 1);
+        fmpz_fdiv_q(m, fmpq_numref(t), fmpq_denref(t));
+
+        s = vas_sgn_dyadic(pol, len, m, *j);
+        fmpz_set(fmpq_numref(t), m);
+        fmpz_one(fmpq_denref(t));
+        fmpq_div_2exp(t, t, (ulong)*j);
+
+        if (s == 0)
+        {
+            fmpq_set(left, t);
+            fmpz_clear(v);
+            fmpz_clear(m);
+            fmpq_clear(t);
+            return 1;
+        }
+        else if (s == sgn)
+        {
+            fmpq_swap(left, t);
+            left_dyadic = 1;
+        }
+        else
+        {
+            fmpq_swap(right, t);
+            right_dyadic = 1;
+        }
+    }
+
+    /* write both endpoints with the same denominator 2^j and bisect */
+    jl = (slong)fmpz_val2(fmpq_denref(left));
+    jr = (slong)fmpz_val2(fmpq_denref(right));
+    *j = FLINT_MAX(jl, jr);
+    fmpz_mul_2exp(u, fmpq_numref(left), (ulong)(*j - jl));
+    fmpz_mul_2exp(v, fmpq_numref(right), (ulong)(*j - jr));
+
+    while (1)
+    {
+        fmpz_sub(m, v, u);
+        if (fmpz_is_one(m))
+        {
+            if (*j >= jmin)
+                break;
+
+            /* no dyadic point m 2^-j can be a root but a dyadic point */
+            /* with a larger denominator might                         */
+            fmpz_mul_2exp(u, u, 1);
+            fmpz_mul_2exp(v, v, 1);
+            (*j)++;
+        }
+
+        fmpz_add(m, u, v);
+        fmpz_fdiv_q_2exp(m, m, 1);
+
+        s = vas_sgn_dyadic(pol, len, m, *j);
+
+        if (s == 0)
+        {
+            fmpz_set(fmpq_numref(left), m);
+            fmpz_one(fmpq_denref(left));
+            fmpq_div_2exp(left, left, (ulong)*j);
+            fmpz_clear(v);
+            fmpz_clear(m);
+            fmpq_clear(t);
+            return 1;
+        }
+        else if (s == sgn)
+            fmpz_swap(u, m);
+        else
+            fmpz_swap(v, m);
+    }
+
+    fmpz_clear(v);
+    fmpz_clear(m);
+    fmpq_clear(t);
+    return 0;
+}
+
+/* Compare the roots i and j by their position. */
+static int vas_roots_cmp(const vas_roots_struct * roots, slong i, slong j)
+{
+    int c = fmpq_cmp(roots->left + i, roots->left + j);
+
+    /* an exact root at the left endpoint of an interval comes first */
+    if (c == 0)
+        c = (roots->sgn[i] != 0) - (roots->sgn[j] != 0);
+
+    return c;
+}
+
+/* Set perm to the permutation that sorts the roots by their position. */
+/* There are at most as many roots as the degree so insertion sort is  */
+/* good enough here.                                                   */
+static void vas_roots_sort(slong * perm, const vas_roots_struct * roots)
+{
+    slong i, j, t;
+
+    for (i = 0; i < roots->length; i++)
+    {
+        t = i;
+        for (j = i; j > 0 && vas_roots_cmp(roots, perm[j - 1], t) > 0; j--)
+            perm[j] = perm[j - 1];
+        perm[j] = t;
+    }
+}
+
+static int vas_is_dyadic(const fmpq_t x)
+{
+    return fmpz_val2(fmpq_denref(x)) + 1 == fmpz_bits(fmpq_denref(x));
+}
+
+void _fmpz_poly_isolate_real_roots_0_1_vas(fmpq * exact_roots, slong * n_exact,
+        fmpz * c_array, slong * k_array, slong * n_intervals,
+        fmpz * pol, slong len)
+{
+    vas_roots_struct roots;
+    slong i, j, l, n_zero, jmin;
+    slong * perm;
+    slong * k;
+    fmpz * c;
+    fmpq_t lo, hi;
+    fmpz_t u, one;
+
+    /* exact roots at zero (reported with multiplicity as VCA does) */
+    for (n_zero = 0; n_zero < len && fmpz_is_zero(pol + n_zero); n_zero++)
+    {
+        if (exact_roots != NULL)
+            fmpq_zero(exact_roots + *n_exact);
+        (*n_exact)++;
+    }
+    pol += n_zero;
+    len -= n_zero;
+
+    if (len <= 1)
+        return;
+
+    fmpz_init(one);
+    fmpz_one(one);
+
+    roots.left = _fmpq_vec_init(len);
+    roots.right = _fmpq_vec_init(len);
+    roots.sgn = (int *) flint_malloc((ulong)len * sizeof(int));
+    roots.length = 0;
+
+    vas_search(&roots, pol, len);
+
+    c = _fmpz_vec_init(len);
+    k = (slong *) flint_malloc((ulong)len * sizeof(slong));
+    perm = (slong *) flint_malloc((ulong)len * sizeof(slong));
+    fmpq_init(lo);
+    fmpq_init(hi);
+    fmpz_init(u);
+
+    /* replace the intervals by dyadic intervals inside of them; this also */
+    /* needs to happen when no intervals are requested since it decides    */
+    /* which roots are dyadic and therefore reported as exact roots        */
+    jmin = (slong)fmpz_val2(pol + len - 1);
+    for (i = 0; i < roots.length; i++)
+    {
+        if (roots.sgn[i] == 0)
+            continue;
+
+        if (vas_dyadic_interval(c + i, k + i, roots.left + i, roots.right + i, roots.sgn[i], pol, len, jmin))
+        {
+            fmpq_set(roots.right + i, roots.left + i);
+            roots.sgn[i] = 0;
+        }
+        else
+        {
+            fmpq_set_fmpz_frac(roots.left + i, c + i, one);
+            fmpq_div_2exp(roots.left + i, roots.left + i, (ulong)k[i]);
+            fmpz_add_ui(u, c + i, 1);
+            fmpq_set_fmpz_frac(roots.right + i, u, one);
+            fmpq_div_2exp(roots.right + i, roots.right + i, (ulong)k[i]);
+        }
+    }
+
+    vas_roots_sort(perm, &roots);
+
+    for (l = 0; l < roots.length; l++)
+    {
+        i = perm[l];
+
+        if (roots.sgn[i] == 0 && vas_is_dyadic(roots.left + i))
+        {
+            if (exact_roots != NULL)
+                fmpq_set(exact_roots + *n_exact, roots.left + i);
+            (*n_exact)++;
+            continue;
+        }
+
+        if ((c_array == NULL) || (k_array == NULL))
+        {
+            (*n_intervals)++;
+            continue;
+        }
+
+        if (roots.sgn[i] == 0)
+        {
+            /* an exact root that is not dyadic; pick a dyadic interval */
+            /* around it that does not meet its neighbours              */
+            if (l == 0)
+                fmpq_zero(lo);
+            else
+                fmpq_set(lo, roots.right + perm[l - 1]);
+            if (l + 1 == roots.length)
+                fmpq_one(hi);
+            else
+                fmpq_set(hi, roots.left + perm[l + 1]);
+
+            for (j = 0; ; j++)
+            {
+                fmpz_mul_2exp(u, fmpq_numref(roots.left + i), (ulong)j);
+                fmpz_fdiv_q(c + i, u, fmpq_denref(roots.left + i));
+
+                fmpq_set_fmpz_frac(roots.right + i, c + i, one);
+                fmpq_div_2exp(roots.right + i, roots.right + i, (ulong)j);
+                if (fmpq_cmp(roots.right + i, lo) < 0)
+                    continue;
+
+                fmpz_add_ui(u, c + i, 1);
+                fmpq_set_fmpz_frac(roots.right + i, u, one);
+                fmpq_div_2exp(roots.right + i, roots.right + i, (ulong)j);
+                if (fmpq_cmp(roots.right + i, hi) > 0)
+                    continue;
+
+                break;
+            }
+            k[i] = j;
+        }
+
+        fmpz_set(c_array + *n_intervals, c + i);
+        k_array[*n_intervals] = -k[i];
+        (*n_intervals)++;
+    }
+
+    _fmpz_vec_clear(c, len);
+    flint_free(k);
+    flint_free(perm);
+    fmpq_clear(lo);
+    fmpq_clear(hi);
+    fmpz_clear(u);
+    fmpz_clear(one);
+    _fmpq_vec_clear(roots.left, len);
+    _fmpq_vec_clear(roots.right, len);
+    flint_free(roots.sgn);
+}
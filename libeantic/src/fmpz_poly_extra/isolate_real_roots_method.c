@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+static int isolate_real_roots_method = FMPZ_POLY_ISOLATE_REAL_ROOTS_VCA;
+
+void fmpz_poly_isolate_real_roots_set_method(int method)
+{
+    if (method != FMPZ_POLY_ISOLATE_REAL_ROOTS_VCA && method != FMPZ_POLY_ISOLATE_REAL_ROOTS_VAS)
+    {
+        fprintf(stderr, "ERROR (fmpz_poly_isolate_real_roots_set_method): unknown method %d\n", method);
+        abort();
+    }
+
+    isolate_real_roots_method = method;
+}
+
+int fmpz_poly_isolate_real_roots_get_method(void)
+{
+    return isolate_real_roots_method;
+}
@@ -0,0 +1,297 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+
+#include <flint/fmpz_vec.h>
+#include <flint/fmpq.h>
+#include <flint/thread_pool.h>
+#include <flint/thread_support.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+/* A node of the subdivision trees. During the breadth-first expansion of the
+ * upper levels of the trees, a node is either a subtree that still needs to
+ * be explored or an interval that is known to contain exactly one root. */
+typedef struct
+{
+    /* The polynomial transformed to the interval of this node. */
+    fmpz * p;
+    slong len;
+
+    /* The interval (c 2^-k, (c + 1) 2^-k) of this node. */
+    fmpz_t c;
+    slong k;
+
+    /* Which of the input polynomials this node belongs to. */
+    slong src;
+
+    /* Whether this node is a leaf that isolates a root. */
+    int isolated;
+
+    /* The roots found when exploring the subtree of this node in the local
+     * coordinates of this node. */
+    fmpz * c_array;
+    slong * k_array;
+    slong n_intervals;
+    slong n_exact;
+} vca_node_struct;
+
+typedef struct
+{
+    vca_node_struct * nodes;
+    slong num;
+    slong next;
+    pthread_mutex_t mutex;
+} vca_work_struct;
+
+static void vca_node_init(vca_node_struct * node, const fmpz * p, slong len, const fmpz_t c, slong k, slong src)
+{
+    node->p = _fmpz_vec_init(len);
+    _fmpz_vec_set(node->p, p, len);
+    node->len = len;
+    fmpz_init_set(node->c, c);
+    node->k = k;
+    node->src = src;
+    node->isolated = 0;
+    node->c_array = NULL;
+    node->k_array = NULL;
+    node->n_intervals = 0;
+    node->n_exact = 0;
+}
+
+static void vca_node_clear(vca_node_struct * node)
+{
+    if (node->p != NULL)
+        _fmpz_vec_clear(node->p, node->len);
+    if (node->c_array != NULL)
+        _fmpz_vec_clear(node->c_array, node->len);
+    flint_free(node->k_array);
+    fmpz_clear(node->c);
+}
+
+/* Explore the subtrees of the pending nodes until all threads are taken by
+ * a worker. Each worker explores one subtree at a time with the sequential
+ * algorithm. Subtrees vary a lot in size so there are more subtrees than
+ * workers and each worker picks the next unexplored one when it is done. */
+static void vca_worker(void * arg)
+{
+    vca_work_struct * work = (vca_work_struct *) arg;
+
+    while (1)
+    {
+        slong i;
+        vca_node_struct * node;
+
+        pthread_mutex_lock(&work->mutex);
+        i = work->next++;
+        pthread_mutex_unlock(&work->mutex);
+
+        if (i >= work->num)
+            return;
+
+        node = work->nodes + i;
+
+        if (node->isolated)
+            continue;
+
+        node->c_array = _fmpz_vec_init(node->len);
+        node->k_array = (slong *) flint_malloc(node->len * sizeof(slong));
+        _fmpz_poly_isolate_real_roots_0_1_vca(NULL, &node->n_exact, node->c_array, node->k_array, &node->n_intervals, node->p, node->len);
+    }
+}
+
+/* Replace the pending nodes in nodes with their children, dropping the ones
+ * without roots, and marking the ones with a single root as isolated.
+ * Returns zero if an exact root has been found. */
+static int vca_expand(vca_node_struct ** nodes, slong * num)
+{
+    slong i, n = 0, alloc = 0;
+    vca_node_struct * children = (vca_node_struct *) flint_malloc(2 * *num * sizeof(vca_node_struct));
+    fmpz * scratch;
+    fmpz_t one, c;
+    int ok = 1;
+
+    fmpz_init_set_ui(one, 1);
+    fmpz_init(c);
+
+    for (i = 0; i < *num; i++)
+        alloc = FLINT_MAX(alloc, (*nodes)[i].len);
+    scratch = _fmpz_vec_init(alloc);
+
+    for (i = 0; i < *num; i++)
+    {
+        vca_node_struct * node = *nodes + i;
+
+        if (!ok || node->isolated)
+        {
+            children[n++] = *node;
+            continue;
+        }
+
+        if (fmpz_is_zero(node->p))
+        {
+            /* The sequential algorithm divides out exact roots which changes
+             * the polynomials of all the nodes to the right. We do not try to
+             * reproduce this. */
+            ok = 0;
+            children[n++] = *node;
+            continue;
+        }
+
+        switch (_fmpz_poly_descartes_bound_0_1_scratch(node->p, node->len, 2, scratch))
+        {
+            case 0:
+                vca_node_clear(node);
+                break;
+            case 1:
+                node->isolated = 1;
+                _fmpz_vec_clear(node->p, node->len);
+                node->p = NULL;
+                children[n++] = *node;
+                break;
+            default:
+                fmpz_mul_2exp(c, node->c, 1);
+                vca_node_init(children + n, node->p, node->len, c, node->k + 1, node->src);
+                _fmpz_poly_scale_2exp(children[n].p, node->len, -1);
+                n++;
+
+                fmpz_add_ui(c, c, 1);
+                vca_node_init(children + n, children[n - 1].p, node->len, c, node->k + 1, node->src);
+                _fmpz_poly_taylor_shift(children[n].p, one, node->len);
+                n++;
+
+                vca_node_clear(node);
+        }
+    }
+
+    flint_free(*nodes);
+    *nodes = children;
+    *num = n;
+
+    _fmpz_vec_clear(scratch, alloc);
+    fmpz_clear(one);
+    fmpz_clear(c);
+
+    return ok;
+}
+
+void _fmpz_poly_isolate_real_roots_0_1_vca_threaded(fmpq ** exact_roots, slong * n_exact, fmpz ** c_array, slong ** k_array, slong * n_intervals, fmpz * const * pols, const slong * lens, slong num, slong thread_limit)
+{
+    slong i, j, num_nodes, num_workers, pending, depth;
+    thread_pool_handle * handles;
+    vca_node_struct * nodes;
+    vca_work_struct work;
+    int ok = 1;
+    fmpz_t zero;
+
+    thread_limit = FLINT_MAX(1, thread_limit);
+
+    num_workers = flint_request_threads(&handles, thread_limit);
+
+    fmpz_init(zero);
+
+    nodes = (vca_node_struct *) flint_malloc(FLINT_MAX(num, 1) * sizeof(vca_node_struct));
+    num_nodes = 0;
+    for (i = 0; i < num; i++)
+        if (lens[i] > 0)
+            vca_node_init(nodes + num_nodes++, pols[i], lens[i], zero, 0, i);
+
+    /* Expand the upper levels of the trees breadth-first until there are
+     * enough subtrees to keep all workers busy. The expansion visits the
+     * nodes in the same order as the sequential depth-first algorithm
+     * would list their roots. */
+    for (depth = 0; ok && depth < 16; depth++)
+    {
+        pending = 0;
+        for (i = 0; i < num_nodes; i++)
+            pending += !nodes[i].isolated;
+
+        if (pending == 0 || pending >= 4 * (num_workers + 1))
+            break;
+
+        ok = vca_expand(&nodes, &num_nodes);
+    }
+
+    if (ok)
+    {
+        work.nodes = nodes;
+        work.num = num_nodes;
+        work.next = 0;
+        pthread_mutex_init(&work.mutex, NULL);
+
+        for (i = 0; i < num_workers; i++)
+            thread_pool_wake(global_thread_pool, handles[i], 0, vca_worker, &work);
+
+        vca_worker(&work);
+
+        for (i = 0; i < num_workers; i++)
+            thread_pool_wait(global_thread_pool, handles[i]);
+
+        pthread_mutex_destroy(&work.mutex);
+
+        for (i = 0; i < num_nodes; i++)
+            ok &= nodes[i].n_exact == 0;
+    }
+
+    flint_give_back_threads(handles, num_workers);
+
+    if (ok)
+    {
+        /* Collect the roots in order translating them from the local
+         * coordinates of each subtree. */
+        for (i = 0; i < num_nodes; i++)
+        {
+            const vca_node_struct * node = nodes + i;
+            const slong s = node->src;
+
+            if (node->isolated)
+            {
+                if (c_array[s] != NULL && k_array[s] != NULL)
+                {
+                    fmpz_set(c_array[s] + n_intervals[s], node->c);
+                    k_array[s][n_intervals[s]] = -node->k;
+                }
+                n_intervals[s]++;
+                continue;
+            }
+
+            for (j = 0; j < node->n_intervals; j++)
+            {
+                if (c_array[s] != NULL && k_array[s] != NULL)
+                {
+                    fmpz * c = c_array[s] + n_intervals[s];
+                    fmpz_mul_2exp(c, node->c, (ulong) -node->k_array[j]);
+                    fmpz_add(c, c, node->c_array + j);
+                    k_array[s][n_intervals[s]] = node->k_array[j] - node->k;
+                }
+                n_intervals[s]++;
+            }
+        }
+    }
+    else
+    {
+        /* Exact roots are rare in practice since they only occur for
+         * polynomials with rational roots. Rather than reproducing how the
+         * sequential algorithm divides them out, we run it instead. */
+        for (i = 0; i < num; i++)
+            if (lens[i] > 0)
+                _fmpz_poly_isolate_real_roots_0_1_vca(exact_roots[i], n_exact + i, c_array[i], k_array[i], n_intervals + i, pols[i], lens[i]);
+    }
+
+    for (i = 0; i < num_nodes; i++)
+        vca_node_clear(nodes + i);
+    flint_free(nodes);
+
+    fmpz_clear(zero);
+}
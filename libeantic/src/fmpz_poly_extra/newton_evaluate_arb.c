@@ -0,0 +1,70 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+void _fmpz_poly_newton_evaluate_arb(arb_t y, arb_t dy, mag_t cond, const fmpz * pol, slong len, const arb_t a, slong prec)
+{
+    /* With m the midpoint of a and R an upper bound for |a|, the Horner   */
+    /* scheme below computes p(m), p'(m) and the majorants                  */
+    /*   M0 = sum |p_i| R^i, M1 = sum i |p_i| R^(i-1),                      */
+    /*   M2 = sum binomial(i, 2) |p_i| R^(i-2).                             */
+    /* Since |p''| <= 2 M2 on a, p'(a) is contained in p'(m) +/- 2 M2 rad(a) */
+    /* and M0 is the relative condition number of p on a.                   */
+    slong i;
+    arb_t m;
+    mag_t R, M0, M1, M2, c;
+
+    arb_init(m);
+    mag_init(R);
+    mag_init(M0);
+    mag_init(M1);
+    mag_init(M2);
+    mag_init(c);
+
+    arb_set_arf(m, arb_midref(a));
+    arb_get_mag(R, a);
+
+    arb_zero(y);
+    arb_zero(dy);
+
+    for (i = len - 1; i >= 0; i--)
+    {
+        arb_mul(dy, dy, m, prec);
+        arb_add(dy, dy, y, prec);
+        arb_mul(y, y, m, prec);
+        arb_add_fmpz(y, y, pol + i, prec);
+
+        mag_mul(M2, M2, R);
+        mag_add(M2, M2, M1);
+        mag_mul(M1, M1, R);
+        mag_add(M1, M1, M0);
+        mag_mul(M0, M0, R);
+        mag_set_fmpz(c, pol + i);
+        mag_add(M0, M0, c);
+    }
+
+    mag_mul(M2, M2, arb_radref(a));
+    mag_mul_2exp_si(M2, M2, 1);
+    arb_add_error_mag(dy, M2);
+
+    if (cond != NULL)
+        mag_swap(cond, M0);
+
+    arb_clear(m);
+    mag_clear(R);
+    mag_clear(M0);
+    mag_clear(M1);
+    mag_clear(M2);
+    mag_clear(c);
+}
@@ -0,0 +1,58 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+int _fmpz_poly_newton_refine_arb(arb_t res, const fmpz * pol, slong len, const arb_t a, slong extra_prec, slong prec)
+{
+    /* Each successful Newton step roughly doubles the number of correct */
+    /* bits. It is therefore sufficient to work at twice the current     */
+    /* accuracy (plus some guard bits) and the cost of the whole         */
+    /* refinement is dominated by the final step at precision prec.      */
+    slong acc, wp, failures = 0;
+    arb_t x, y;
+
+    arb_init(x);
+    arb_init(y);
+    arb_set(x, a);
+
+    while ((acc = arb_rel_accuracy_bits(x)) < prec)
+    {
+        wp = FLINT_MIN(2 * FLINT_MAX(acc, 32), prec) + extra_prec + 16;
+
+        if (_fmpz_poly_newton_step_cond_arb(y, NULL, pol, len, x, wp))
+        {
+            arb_swap(x, y);
+            failures = 0;
+        }
+        else
+        {
+            /* the polynomial could not be evaluated accurately enough */
+            /* or a is not within the region of quadratic convergence  */
+            if (++failures == 8)
+            {
+                arb_clear(x);
+                arb_clear(y);
+                return 0;
+            }
+            extra_prec = 2 * extra_prec + 32;
+        }
+    }
+
+    arb_swap(res, x);
+
+    arb_clear(x);
+    arb_clear(y);
+
+    return 1;
+}
@@ -17,12 +17,18 @@
 #include "../../e-antic/fmpz_poly_extra.h"
 
 int _fmpz_poly_newton_step_arb(arb_t res, const fmpz * pol, const fmpz * der, slong len, arb_t a, slong prec)
+{
+    (void) der;
+    return _fmpz_poly_newton_step_cond_arb(res, NULL, pol, len, a, prec);
+}
+
+int _fmpz_poly_newton_step_cond_arb(arb_t res, mag_t cond, const fmpz * pol, slong len, const arb_t a, slong prec)
 {
     /* Newton step corresponds to set: res = a - f(a) / f'(a)            */
     /* In order to make it works with intervals, we do the following     */
     /*   - set m to be the ball with radius 0 and same center as a       */
-    /*   - set res = m - f(m) / f'(a) where evaluation of both f and f'  */
-    /*     is done with ball evaluation                                  */
+    /*   - set res = m - f(m) / f'(a) where f(m) and an enclosure of f'  */
+    /*     on a are computed in a single pass over the coefficients      */
     arb_t m, y;
 
     if (prec <= 0)
@@ -31,16 +37,19 @@ int _fmpz_poly_newton_step_arb(arb_t res, const fmpz * pol, const fmpz * der, sl
         abort();
     }
 
-    _fmpz_poly_evaluate_arb(res, der, len - 1, a, prec);
-    if (arb_contains_zero(res)) return 0;
+    arb_init(y);
+
+    _fmpz_poly_newton_evaluate_arb(y, res, cond, pol, len, a, prec);
+    if (arb_contains_zero(res))
+    {
+        arb_clear(y);
+        return 0;
+    }
 
     arb_init(m);
-    arb_init(y);
     arf_set(arb_midref(m), arb_midref(a));
     mag_zero(arb_radref(m));
 
-    _fmpz_poly_evaluate_arb(y, pol, len, m, prec);
-
     arb_div(res, y, res, prec);
     arb_sub(res, res, m, prec);
     arb_neg(res, res);
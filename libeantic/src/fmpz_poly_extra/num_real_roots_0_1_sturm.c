@@ -11,17 +11,17 @@
 
 #include <stdlib.h>
 
+#include <flint/fmpq.h>
+
 #include "../../e-antic/config.h"
 
 #include "../../e-antic/fmpz_poly_extra.h"
 
 slong fmpz_poly_num_real_roots_0_1_sturm(fmpz_poly_t pol)
 {
-    fmpz_poly_t p0, p1;
-    slong i;
-    ulong d;
-    fmpz_t c;
-    int s, s0a, s0b, t;
+    slong n;
+    fmpq_t a, b;
+    fmpz_poly_sturm_t S;
 
     if (fmpz_poly_is_zero(pol))
     {
@@ -29,61 +29,16 @@ slong fmpz_poly_num_real_roots_0_1_sturm(fmpz_poly_t pol)
         abort();
     }
 
-    fmpz_init(c);
-    fmpz_poly_init(p0);
-    fmpz_poly_init(p1);
-
-    fmpz_poly_set(p0, pol);
-    fmpz_poly_derivative(p1, p0);
-
-    s0a = fmpz_sgn(pol->coeffs);
-    fmpz_poly_evaluate_at_one(c, pol->coeffs, pol->length);
-    s0b = fmpz_sgn(c);
-
-    /* Sturm's theorem counts roots in (0, 1], so count if there's one at 0 */
-    if (s0a == 0)
-      t = 1;
-    else
-      t = 0;
-
-    while (!fmpz_poly_is_zero(p1))
-    {
-        /* sign change at 0 */
-        s = fmpz_sgn(p1->coeffs);
-        if (s != 0)
-        {
-            if (s0a != 0 && s != s0a)
-                t++;
-            s0a = s;
-        }
-
-        /* sign change at 1 */
-        fmpz_poly_evaluate_at_one(c, p1->coeffs, p1->length);
-        s = fmpz_sgn(c);
-        if (s != 0)
-        {
-            if (s0b != 0 && s != s0b)
-                t--;
-            s0b = s;
-        }
+    fmpq_init(a);
+    fmpq_init(b);
+    fmpq_one(b);
 
-        fmpz_poly_swap(p0, p1);
-        fmpz_poly_pseudo_rem(p1, &d, p1, p0);
-        if ((d%2 == 0) || (fmpz_sgn(p0->coeffs + p0->length - 1) == 1))
-            fmpz_poly_neg(p1, p1);
-        fmpz_poly_content(c, p1);
-        if (!fmpz_is_one(c))
-        {
-            for (i = 0; i < p1->length; i++)
-                fmpz_divexact(p1->coeffs + i, p1->coeffs + i, c);
-        }
-    }
+    fmpz_poly_sturm_init(S, pol);
+    n = fmpz_poly_sturm_num_roots_fmpq(S, a, b);
+    fmpz_poly_sturm_clear(S);
 
-    fmpz_poly_clear(p0);
-    fmpz_poly_clear(p1);
-    fmpz_clear(c);
+    fmpq_clear(a);
+    fmpq_clear(b);
 
-    return t;
+    return n;
 }
-
-
@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#include <flint/fmpz_vec.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+/* We compute a subresultant remainder sequence (as in FLINT's subresultant */
+/* gcd) but take absolute values of the divisors and fix the signs so that */
+/* each element is a positive multiple of the Sturm remainder             */
+/* -rem(seq[i - 1], seq[i]). The absolute values of the coefficients are  */
+/* the ones of the subresultants so all divisions are exact.              */
+void fmpz_poly_sturm_init(fmpz_poly_sturm_t S, const fmpz_poly_t pol)
+{
+    slong i, len, delta;
+    ulong d;
+    fmpz_t g, h, c;
+    fmpz_poly_t r;
+
+    if (fmpz_poly_is_zero(pol))
+    {
+        fprintf(stderr, "ERROR (fmpz_poly_sturm_init): zero polynomial\n");
+        abort();
+    }
+
+    len = pol->length;
+
+    S->seq = (fmpz_poly_struct *) flint_malloc((ulong)len * sizeof(fmpz_poly_struct));
+    for (i = 0; i < len; i++)
+        fmpz_poly_init(S->seq + i);
+    S->alloc = len;
+
+    fmpz_poly_set(S->seq, pol);
+    S->length = 1;
+
+    if (len == 1)
+        return;
+
+    fmpz_poly_derivative(S->seq + 1, pol);
+    S->length = 2;
+
+    fmpz_init(g);
+    fmpz_init(h);
+    fmpz_init(c);
+    fmpz_poly_init(r);
+
+    fmpz_one(g);
+    fmpz_one(h);
+
+    while (S->length < len)
+    {
+        fmpz_poly_struct * A = S->seq + S->length - 2;
+        fmpz_poly_struct * B = S->seq + S->length - 1;
+        const fmpz * lc = B->coeffs + B->length - 1;
+
+        if (B->length == 1)
+            break;
+
+        delta = A->length - B->length;
+
+        /* pseudo remainder with the exponent delta + 1 that the */
+        /* subresultant divisibility relies on                   */
+        fmpz_poly_pseudo_rem(r, &d, A, B);
+        if (fmpz_poly_is_zero(r))
+            break;
+        if (d < (ulong)delta + 1)
+        {
+            fmpz_pow_ui(c, lc, (ulong)delta + 1 - d);
+            fmpz_poly_scalar_mul_fmpz(r, r, c);
+        }
+
+        if (delta % 2 == 1 || fmpz_sgn(lc) > 0)
+            fmpz_poly_neg(r, r);
+
+        fmpz_pow_ui(c, h, (ulong)delta);
+        fmpz_mul(c, c, g);
+        fmpz_poly_scalar_divexact_fmpz(S->seq + S->length, r, c);
+
+        fmpz_abs(g, lc);
+        if (delta == 0)
+            ;
+        else if (delta == 1)
+            fmpz_set(h, g);
+        else
+        {
+            fmpz_pow_ui(c, h, (ulong)delta - 1);
+            fmpz_pow_ui(h, g, (ulong)delta);
+            fmpz_divexact(h, h, c);
+        }
+
+        S->length++;
+    }
+
+    /* If pol is not squarefree, the last element is (a multiple of) the */
+    /* gcd of pol and its derivative. Dividing by it does not change the */
+    /* sign changes away from its roots but makes the count correct at   */
+    /* endpoints that are multiple roots.                                */
+    if (S->seq[S->length - 1].length > 1)
+    {
+        fmpz_poly_primitive_part(r, S->seq + S->length - 1);
+        for (i = 0; i < S->length; i++)
+            fmpz_poly_div(S->seq + i, S->seq + i, r);
+    }
+
+    fmpz_clear(g);
+    fmpz_clear(h);
+    fmpz_clear(c);
+    fmpz_poly_clear(r);
+}
+
+void fmpz_poly_sturm_clear(fmpz_poly_sturm_t S)
+{
+    slong i;
+
+    for (i = 0; i < S->alloc; i++)
+        fmpz_poly_clear(S->seq + i);
+    flint_free(S->seq);
+}
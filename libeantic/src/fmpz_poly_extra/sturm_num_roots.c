@@ -0,0 +1,165 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <flint/fmpq.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+/* Return the number of sign changes of the sequence S at x and set */
+/* zero if x is a root of the polynomial of S.                      */
+static slong sturm_sign_changes_fmpq(int * zero, const fmpz_poly_sturm_t S, const fmpq_t x)
+{
+    slong i, changes = 0;
+    int s, last = 0;
+    fmpq_t y;
+
+    fmpq_init(y);
+
+    for (i = 0; i < S->length; i++)
+    {
+        fmpz_poly_evaluate_fmpq(y, S->seq + i, x);
+        s = fmpq_sgn(y);
+
+        if (i == 0)
+            *zero = (s == 0);
+
+        if (s != 0)
+        {
+            if (last != 0 && s != last)
+                changes++;
+            last = s;
+        }
+    }
+
+    fmpq_clear(y);
+
+    return changes;
+}
+
+/* As sturm_sign_changes_fmpq but with arb arithmetic at the point x. */
+/* The exact value of x is only used when a sign cannot be decided.   */
+static slong sturm_sign_changes_arf(int * zero, const fmpz_poly_sturm_t S, const arf_t x, slong prec)
+{
+    slong i, changes = 0;
+    int s, last = 0, exact = 0;
+    arb_t b, y;
+    fmpq_t q, z;
+
+    arb_init(b);
+    arb_init(y);
+    fmpq_init(q);
+    fmpq_init(z);
+
+    arb_set_arf(b, x);
+
+    for (i = 0; i < S->length; i++)
+    {
+        _fmpz_poly_evaluate_arb(y, S->seq[i].coeffs, S->seq[i].length, b, prec);
+
+        if (arb_is_positive(y))
+            s = 1;
+        else if (arb_is_negative(y))
+            s = -1;
+        else
+        {
+            if (!exact)
+            {
+                arf_get_fmpq(q, x);
+                exact = 1;
+            }
+            fmpz_poly_evaluate_fmpq(z, S->seq + i, q);
+            s = fmpq_sgn(z);
+        }
+
+        if (i == 0)
+            *zero = (s == 0);
+
+        if (s != 0)
+        {
+            if (last != 0 && s != last)
+                changes++;
+            last = s;
+        }
+    }
+
+    arb_clear(b);
+    arb_clear(y);
+    fmpq_clear(q);
+    fmpq_clear(z);
+
+    return changes;
+}
+
+/* Return the number of sign changes of S at +infinity or, if neg is set, */
+/* at -infinity.                                                         */
+static slong sturm_sign_changes_inf(const fmpz_poly_sturm_t S, int neg)
+{
+    slong i, changes = 0;
+    int s, last = 0;
+
+    for (i = 0; i < S->length; i++)
+    {
+        const fmpz_poly_struct * p = S->seq + i;
+
+        s = fmpz_sgn(p->coeffs + p->length - 1);
+        if (neg && p->length % 2 == 0)
+            s = -s;
+
+        if (last != 0 && s != last)
+            changes++;
+        last = s;
+    }
+
+    return changes;
+}
+
+slong fmpz_poly_sturm_num_real_roots(const fmpz_poly_sturm_t S)
+{
+    return sturm_sign_changes_inf(S, 1) - sturm_sign_changes_inf(S, 0);
+}
+
+slong fmpz_poly_sturm_num_roots_fmpq(const fmpz_poly_sturm_t S, const fmpq_t a, const fmpq_t b)
+{
+    slong n;
+    int zero, unused;
+
+    if (fmpq_cmp(a, b) > 0)
+        return 0;
+
+    /* Sturm's theorem counts the roots in (a, b] */
+    n = sturm_sign_changes_fmpq(&zero, S, a) - sturm_sign_changes_fmpq(&unused, S, b);
+
+    return n + zero;
+}
+
+slong fmpz_poly_sturm_num_roots_arb(const fmpz_poly_sturm_t S, const arb_t a, slong prec)
+{
+    slong n;
+    int zero, unused;
+    arf_t l, r;
+
+    if (!arb_is_finite(a))
+        return fmpz_poly_sturm_num_real_roots(S);
+
+    arf_init(l);
+    arf_init(r);
+
+    arb_get_interval_arf(l, r, a, ARF_PREC_EXACT);
+
+    n = sturm_sign_changes_arf(&zero, S, l, prec) - sturm_sign_changes_arf(&unused, S, r, prec);
+
+    arf_clear(l);
+    arf_clear(r);
+
+    return n + zero;
+}
@@ -13,9 +13,10 @@
 
 #include "../../e-antic/renf.h"
 
+#include "shared.h"
+
 void renf_clear(renf_t nf)
 {
-    nf_clear(nf->nf);
-    fmpz_poly_clear(nf->der);
+    _renf_shared_release(nf);
     arb_clear(nf->emb);
 }
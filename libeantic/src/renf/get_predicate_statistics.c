@@ -0,0 +1,20 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf.h"
+
+void renf_get_predicate_statistics(ulong * predicates, ulong * escalations, const renf_t nf)
+{
+    *predicates = nf->predicates;
+    *escalations = nf->escalations;
+}
@@ -14,11 +14,50 @@
 #include "../../e-antic/config.h"
 
 #include "../../e-antic/renf.h"
+#include "../../e-antic/renf_cache.h"
+#include "../../e-antic/renf_trace.h"
 #include "../../e-antic/fmpq_poly_extra.h"
 
+#include "shared.h"
+
+void _renf_init(renf_t nf, fmpq_poly_t pol, arb_t emb, slong prec)
+{
+    arb_init(nf->emb);
+    arb_set(nf->emb, emb);
+    _renf_shared_init(nf, pol);
+    nf->prec = prec;
+    nf->prec_min = prec;
+    nf->prec_max = prec;
+    nf->predicates = 0;
+    nf->escalations = 0;
+    nf->predicates_adapted = 0;
+    nf->escalations_adapted = 0;
+    nf->immutable = 0;
+    renf_reset_statistics(nf);
+}
+
 void renf_init(renf_t nf, fmpq_poly_t pol, arb_t emb, slong prec)
 {
-    const slong len = pol->length;
+    renf_cache * cache = renf_get_cache();
+    ulong start = _renf_trace_start();
+
+    if (cache != NULL && pol->length > 2)
+    {
+        arb_t e;
+        int cached;
+
+        arb_init(e);
+        cached = renf_cache_get(e, cache, pol, emb, prec);
+        if (cached)
+            _renf_init(nf, pol, e, prec);
+        arb_clear(e);
+
+        if (cached)
+        {
+            _renf_trace(RENF_TRACE_CONSTRUCTION, nf, arb_rel_accuracy_bits(emb), arb_rel_accuracy_bits(nf->emb), start);
+            return;
+        }
+    }
 
     if (!fmpq_poly_check_unique_real_root(pol, emb, prec))
     {
@@ -26,16 +65,15 @@ void renf_init(renf_t nf, fmpq_poly_t pol, arb_t emb, slong prec)
         abort();
     }
 
-    arb_init(nf->emb);
-    arb_set(nf->emb, emb);
-    nf_init(nf->nf, pol);
-    fmpz_poly_init(nf->der);
-    fmpz_poly_fit_length(nf->der, len - 1);
-    _fmpz_poly_derivative(nf->der->coeffs, fmpq_poly_numref(pol), len);
-    _fmpz_poly_set_length(nf->der, len - 1);
-    nf->prec = prec;
-    nf->immutable = 0;
+    _renf_init(nf, pol, emb, prec);
 
     if (!(nf->nf->flag & NF_LINEAR))
+    {
         renf_refine_embedding(nf, prec);
+
+        if (cache != NULL)
+            renf_cache_set(cache, pol, emb, nf->emb, prec);
+    }
+
+    _renf_trace(RENF_TRACE_CONSTRUCTION, nf, arb_rel_accuracy_bits(emb), arb_rel_accuracy_bits(nf->emb), start);
 }
@@ -13,16 +13,22 @@
 
 #include "../../e-antic/renf.h"
 
+#include "shared.h"
+
 void renf_init_set(renf_t dest, const renf_t src)
 {
     arb_init(dest->emb);
     arb_set(dest->emb, src->emb);
 
-    nf_init(dest->nf, src->nf->pol);
-
-    fmpz_poly_init(dest->der);
-    fmpz_poly_set(dest->der, src->der);
+    _renf_shared_acquire(dest, src);
 
     dest->prec = src->prec;
+    dest->prec_min = src->prec_min;
+    dest->prec_max = src->prec_max;
+    dest->predicates = 0;
+    dest->escalations = 0;
+    dest->predicates_adapted = 0;
+    dest->escalations_adapted = 0;
     dest->immutable = 0;
+    renf_reset_statistics(dest);
 }
@@ -0,0 +1,65 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf.h"
+
+/* The number of predicates after which the precision is reconsidered. */
+#define RENF_PREC_WINDOW 128
+
+/* The number of windows without escalations after which the precision is
+ * lowered. */
+#define RENF_PREC_LOWER 16
+
+void _renf_record_predicate(renf_t nf, int escalated)
+{
+    ulong predicates, escalations;
+
+    /* Without a range of precisions, the field might be shared between
+     * threads, so we must not touch it. */
+    if (nf->prec_min == nf->prec_max)
+        return;
+
+    /* Immutable fields might be shared between threads. */
+    if (nf->immutable)
+        return;
+
+    nf->predicates++;
+    if (escalated)
+        nf->escalations++;
+
+    predicates = nf->predicates - nf->predicates_adapted;
+    if (predicates % RENF_PREC_WINDOW)
+        return;
+
+    escalations = nf->escalations - nf->escalations_adapted;
+
+    /* An escalation is much more expensive than arithmetic at a higher
+     * precision. So we raise the precision quickly but only lower it after a
+     * long stretch of predicates that were all decided by the enclosures. */
+    if (16 * escalations > predicates)
+    {
+        nf->prec = FLINT_MIN(2 * nf->prec, nf->prec_max);
+    }
+    else if (predicates >= RENF_PREC_LOWER * RENF_PREC_WINDOW)
+    {
+        if (escalations == 0)
+            nf->prec = FLINT_MAX(nf->prec - nf->prec / 4, nf->prec_min);
+    }
+    else
+    {
+        return;
+    }
+
+    nf->predicates_adapted = nf->predicates;
+    nf->escalations_adapted = nf->escalations;
+}
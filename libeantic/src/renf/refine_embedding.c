@@ -16,12 +16,21 @@
 
 #include "../../e-antic/fmpz_poly_extra.h"
 #include "../../e-antic/renf.h"
+#include "../../e-antic/renf_trace.h"
+
+#include "statistics.h"
 
 void renf_refine_embedding(renf_t nf, slong prec)
 {
     arb_t tmp;
+    arf_t c;
+    mag_t m_cond;
     slong cond;
     slong comp_prec;
+    slong accuracy = arb_rel_accuracy_bits(nf->emb);
+    ulong start = _renf_trace_start();
+
+    RENF_STATISTICS_ADD(nf, refinements);
 
     assert(!renf_set_immutable(nf, 1) && "An embedding cannot be safely refined in a multi-threaded environment; you should have refined as needed and called renf_set_immutable() before entering multi-threaded code. Alternatively, you might also be able to use a distinct copy of the renf_t in each thread.");
 
@@ -30,35 +39,57 @@ void renf_refine_embedding(renf_t nf, slong prec)
             nf->emb, FLINT_MAX(nf->prec, 64));
     cond *= nf->nf->pol->length;
     arb_init(tmp);
+    arf_init(c);
+    mag_init(m_cond);
 
+    /* Bisect and take single Newton steps until Newton's method converges */
+    /* quadratically. Then refine with a precision doubling schedule.      */
     comp_prec = 2 * FLINT_ABS(arb_rel_accuracy_bits(nf->emb)) + cond;
     while (arb_rel_accuracy_bits(nf->emb) < prec)
     {
-        if(!_fmpz_poly_newton_step_arb(tmp,
+        if(_fmpz_poly_newton_step_cond_arb(tmp, m_cond,
                 fmpq_poly_numref(nf->nf->pol),
-                nf->der->coeffs,
                 fmpq_poly_length(nf->nf->pol),
                 nf->emb,
                 comp_prec))
         {
-            if(!_fmpz_poly_bisection_step_arb(tmp,
+            arb_swap(tmp, nf->emb);
+
+            /* now that the embedding is accurate, so is the condition */
+            /* number on the previous ball, which the Newton step      */
+            /* computed along the way                                  */
+            arf_set_mag(c, m_cond);
+            cond = arf_abs_bound_lt_2exp_si(c) * nf->nf->pol->length;
+
+            if (_fmpz_poly_newton_refine_arb(tmp,
+                    fmpq_poly_numref(nf->nf->pol),
+                    fmpq_poly_length(nf->nf->pol),
+                    nf->emb,
+                    cond,
+                    prec))
+                arb_swap(tmp, nf->emb);
+        }
+        else if(_fmpz_poly_bisection_step_arb(tmp,
                     fmpq_poly_numref(nf->nf->pol),
                     fmpq_poly_length(nf->nf->pol),
                     nf->emb,
                     comp_prec))
-            {
-                comp_prec *= 2;
-                continue;
-            }
+        {
+            arb_swap(tmp, nf->emb);
+        }
+        else
+        {
+            comp_prec *= 2;
+            continue;
         }
-        arb_swap(tmp, nf->emb);
 
-        _fmpz_poly_relative_condition_number_2exp(&cond,
-                nf->nf->pol->coeffs, nf->nf->pol->length,
-                nf->emb, 32);
-        comp_prec = 2 * FLINT_ABS(arb_rel_accuracy_bits(nf->emb)) + cond * nf->nf->pol->length;
+        comp_prec = 2 * FLINT_ABS(arb_rel_accuracy_bits(nf->emb)) + cond;
     }
     arb_clear(tmp);
+    arf_clear(c);
+    mag_clear(m_cond);
+
+    _renf_trace(RENF_TRACE_REFINE_EMBEDDING, nf, accuracy, arb_rel_accuracy_bits(nf->emb), start);
 
     assert(renf_set_immutable(nf, 0) && "An embedding cannot be safely refined in a multi-threaded environment; you should have refined as needed and called renf_set_immutable() before entering multi-threaded code. Alternatively, you might also be able to use a distinct copy of the renf_t in each thread.");
 }
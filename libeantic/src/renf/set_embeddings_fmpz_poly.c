@@ -9,61 +9,295 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+
 #include <assert.h>
+#include <pthread.h>
 #include <stdlib.h>
 
 #include <flint/fmpz_vec.h>
+#include <flint/fmpq.h>
+#include <flint/fmpq_vec.h>
+#include <flint/fmpz_poly_factor.h>
+#include <flint/nmod_poly.h>
+#include <flint/thread_pool.h>
+#include <flint/thread_support.h>
 
 #include "../../e-antic/config.h"
 
 #include "../../e-antic/renf.h"
 #include "../../e-antic/fmpz_poly_extra.h"
 
+typedef struct
+{
+    renf * nf;
+    slong num;
+    slong next;
+    slong prec;
+    pthread_mutex_t mutex;
+} refine_work_struct;
+
+/* Refine the embeddings of the fields in work one at a time until all of */
+/* them have been refined.                                                */
+static void refine_worker(void * arg)
+{
+    refine_work_struct * work = (refine_work_struct *) arg;
+
+    while (1)
+    {
+        slong i;
+
+        pthread_mutex_lock(&work->mutex);
+        i = work->next++;
+        pthread_mutex_unlock(&work->mutex);
+
+        if (i >= work->num)
+            return;
+
+        if (!(work->nf[i].nf->flag & NF_LINEAR))
+            renf_refine_embedding(work->nf + i, work->prec);
+    }
+}
+
+static void refine_embeddings(renf * nf, slong num, slong prec)
+{
+    slong i, num_workers;
+    thread_pool_handle * handles;
+    refine_work_struct work;
+
+    num_workers = flint_request_threads(&handles, FLINT_MIN(num, flint_get_num_threads()));
+
+    work.nf = nf;
+    work.num = num;
+    work.next = 0;
+    work.prec = prec;
+    pthread_mutex_init(&work.mutex, NULL);
+
+    for (i = 0; i < num_workers; i++)
+        thread_pool_wake(global_thread_pool, handles[i], 0, refine_worker, &work);
+
+    refine_worker(&work);
+
+    for (i = 0; i < num_workers; i++)
+        thread_pool_wait(global_thread_pool, handles[i]);
+
+    pthread_mutex_destroy(&work.mutex);
+
+    flint_give_back_threads(handles, num_workers);
+}
+
+/* Initialize nf as the field of degree one with the rational embedding r. */
+static void init_rational(renf_t nf, const fmpq_t r, slong prec)
+{
+    fmpq_poly_t p;
+    fmpq_t m;
+    arb_t a;
+
+    fmpq_poly_init(p);
+    fmpq_init(m);
+    arb_init(a);
+
+    fmpq_neg(m, r);
+    fmpq_poly_set_coeff_si(p, 1, 1);
+    fmpq_poly_set_coeff_fmpq(p, 0, m);
+    arb_set_fmpq(a, r, prec);
+
+    _renf_init(nf, p, a, prec);
+
+    fmpq_poly_clear(p);
+    fmpq_clear(m);
+    arb_clear(a);
+}
+
+/* Return whether the squarefree polynomial pol is certainly irreducible.  */
+/* The degrees of the factors modulo a few primes restrict the possible    */
+/* degrees of the factors over the integers. If no proper degree survives, */
+/* pol is irreducible. Otherwise, it might still be irreducible.           */
+static int is_irreducible_modular(const fmpz_poly_t pol)
+{
+    const slong n = fmpz_poly_degree(pol);
+    slong d, i, s, primes;
+    char * possible;
+    char * sums;
+    nmod_poly_t q;
+    nmod_poly_factor_t fac;
+    ulong p = UWORD(1) << (FLINT_BITS - 2);
+    int irreducible = 0;
+
+    if (n <= 1)
+        return 1;
+
+    possible = (char *) flint_malloc((ulong)(n + 1));
+    sums = (char *) flint_malloc((ulong)(n + 1));
+    for (d = 0; d <= n; d++)
+        possible[d] = 1;
+
+    for (primes = 0, i = 0; primes < 8 && i < 32 && !irreducible; i++)
+    {
+        p = n_nextprime(p, 1);
+
+        if (fmpz_fdiv_ui(fmpz_poly_lead(pol), p) == 0)
+            continue;
+
+        nmod_poly_init(q, p);
+        fmpz_poly_get_nmod_poly(q, pol);
+
+        if (nmod_poly_is_squarefree(q))
+        {
+            primes++;
+
+            nmod_poly_factor_init(fac);
+            nmod_poly_factor(fac, q);
+
+            sums[0] = 1;
+            for (d = 1; d <= n; d++)
+                sums[d] = 0;
+            for (s = 0; s < fac->num; s++)
+                for (d = n; d >= nmod_poly_degree(fac->p + s); d--)
+                    sums[d] |= sums[d - nmod_poly_degree(fac->p + s)];
+
+            irreducible = 1;
+            for (d = 1; d < n; d++)
+            {
+                possible[d] &= sums[d];
+                if (possible[d])
+                    irreducible = 0;
+            }
+
+            nmod_poly_factor_clear(fac);
+        }
+
+        nmod_poly_clear(q);
+    }
+
+    flint_free(possible);
+    flint_free(sums);
+
+    return irreducible;
+}
+
 slong renf_set_embeddings_fmpz_poly(renf * nf, fmpz_poly_t pol, slong lim, slong prec)
 {
-    slong i, n, n_exact, n_interval;
+    slong i, j, n, n_exact, n_interval, num;
+    fmpz_poly_t sqf;
+    fmpz_poly_factor_t fac;
     fmpq_poly_t p2;
+    fmpq * exact;
+    fmpq_t l, r, v;
     arb_t a;
     fmpz * c;
     slong * k;
 
-    n = fmpz_poly_num_real_roots_upper_bound(pol);
-    c = _fmpz_vec_init(n);
+    fmpz_poly_init(sqf);
+    fmpz_poly_squarefree_part(sqf, pol);
 
+    n = fmpz_poly_num_real_roots_upper_bound(sqf);
     assert(n >= 0);
+
+    c = _fmpz_vec_init(n);
     k = (slong *) flint_malloc((ulong)n * sizeof(slong));
+    exact = _fmpq_vec_init(n);
 
-    fmpz_poly_isolate_real_roots(NULL, &n_exact, c, k, &n_interval, pol);
+    fmpz_poly_isolate_real_roots(exact, &n_exact, c, k, &n_interval, sqf);
 
-    if (n_exact)
+    /* Since the roots of sqf are isolated already, the root of a factor */
+    /* in an isolating interval does not need to be checked to be unique. */
+    /* Usually, sqf is irreducible and does not need to be factored.      */
+    fmpz_poly_factor_init(fac);
+    if (n_exact + n_interval > 0)
     {
-        fprintf(stderr, "ERROR (fmpz_poly_real_embeddings): rational roots\n");
-        abort();
+        if ((n_exact > 0 && fmpz_poly_degree(sqf) > 1) || !is_irreducible_modular(sqf))
+            fmpz_poly_factor(fac, sqf);
+        else
+            fmpz_poly_factor_insert(fac, sqf, 1);
     }
 
     arb_init(a);
+    fmpq_init(l);
+    fmpq_init(r);
+    fmpq_init(v);
     fmpq_poly_init(p2);
-    fmpz_one(fmpq_poly_denref(p2));
-    fmpq_poly_fit_length(p2, pol->length);
-    _fmpz_vec_set(p2->coeffs, pol->coeffs, pol->length);
-    p2->length = pol->length;
-    for (i = 0; i < FLINT_MIN(lim, n_interval); i++)
+
+    /* merge the exact roots and the isolating intervals which are both */
+    /* sorted by position                                               */
+    num = FLINT_MIN(lim, n_exact + n_interval);
+    for (i = j = 0; i + j < num; )
     {
-        arb_set_fmpz(a, c + i);
-        arb_mul_2exp_si(a, a, 1);
-        arb_add_si(a, a, 1, prec);
-        mag_one(arb_radref(a));
-        arb_mul_2exp_si(a, a, k[i] - 1);
+        if (i < n_interval)
+        {
+            fmpz_set(fmpq_numref(l), c + i);
+            fmpz_one(fmpq_denref(l));
+            fmpz_add_ui(fmpq_numref(r), c + i, 1);
+            fmpz_one(fmpq_denref(r));
+            if (k[i] >= 0)
+            {
+                fmpq_mul_2exp(l, l, (ulong)k[i]);
+                fmpq_mul_2exp(r, r, (ulong)k[i]);
+            }
+            else
+            {
+                fmpq_div_2exp(l, l, (ulong)-k[i]);
+                fmpq_div_2exp(r, r, (ulong)-k[i]);
+            }
+        }
+
+        if (j < n_exact && (i == n_interval || fmpq_cmp(exact + j, l) <= 0))
+        {
+            init_rational(nf + i + j, exact + j, prec);
+            j++;
+            continue;
+        }
+
+        /* the factor that changes its sign on the interval has the root */
+        {
+            slong f;
+            int sl, sr;
+
+            for (f = 0; f < fac->num; f++)
+            {
+                fmpz_poly_evaluate_fmpq(v, fac->p + f, l);
+                sl = fmpq_sgn(v);
+                fmpz_poly_evaluate_fmpq(v, fac->p + f, r);
+                sr = fmpq_sgn(v);
+                if (sl * sr < 0)
+                    break;
+            }
 
-        renf_init(nf + i, p2, a, prec);
+            assert(f < fac->num && "none of the factors has a root in the isolating interval");
 
+            if (fmpz_poly_degree(fac->p + f) == 1)
+            {
+                fmpz_neg(fmpq_numref(v), fac->p[f].coeffs);
+                fmpz_set(fmpq_denref(v), fac->p[f].coeffs + 1);
+                fmpq_canonicalise(v);
+                init_rational(nf + i + j, v, prec);
+            }
+            else
+            {
+                arb_set_fmpz(a, c + i);
+                arb_mul_2exp_si(a, a, 1);
+                arb_add_si(a, a, 1, prec);
+                mag_one(arb_radref(a));
+                arb_mul_2exp_si(a, a, k[i] - 1);
+
+                fmpq_poly_set_fmpz_poly(p2, fac->p + f);
+                _renf_init(nf + i + j, p2, a, prec);
+            }
+        }
+        i++;
     }
 
+    refine_embeddings(nf, num, prec);
+
     arb_clear(a);
+    fmpq_clear(l);
+    fmpq_clear(r);
+    fmpq_clear(v);
     fmpq_poly_clear(p2);
+    fmpz_poly_factor_clear(fac);
+    fmpz_poly_clear(sqf);
     _fmpz_vec_clear(c, n);
+    _fmpq_vec_clear(exact, n);
     flint_free(k);
 
-    return n_interval;
+    return n_exact + n_interval;
 }
-
@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf.h"
+
+void renf_set_prec_range(renf_t nf, slong prec_min, slong prec_max)
+{
+    if (prec_min <= 0 || prec_min > prec_max)
+    {
+        fprintf(stderr, "ERROR (renf_set_prec_range): invalid range of precisions\n");
+        abort();
+    }
+
+    nf->prec_min = prec_min;
+    nf->prec_max = prec_max;
+    nf->prec = FLINT_MIN(FLINT_MAX(nf->prec, prec_min), prec_max);
+    nf->predicates_adapted = nf->predicates;
+    nf->escalations_adapted = nf->escalations;
+}
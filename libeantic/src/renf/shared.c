@@ -0,0 +1,67 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "shared.h"
+
+void _renf_shared_init(renf_t nf, const fmpq_poly_t pol)
+{
+    const slong len = pol->length;
+    struct renf_shared * shared = flint_malloc(sizeof(struct renf_shared));
+
+    nf_init(shared->nf, pol);
+    fmpz_poly_init(shared->der);
+    fmpz_poly_fit_length(shared->der, len - 1);
+    _fmpz_poly_derivative(shared->der->coeffs, fmpq_poly_numref(pol), len);
+    _fmpz_poly_set_length(shared->der, len - 1);
+    shared->refcount = 1;
+    pthread_mutex_init(&shared->mutex, NULL);
+
+    nf->shared = shared;
+    nf->nf = shared->nf;
+    nf->der = shared->der;
+}
+
+void _renf_shared_acquire(renf_t dest, const renf_t src)
+{
+    struct renf_shared * shared = src->shared;
+
+    pthread_mutex_lock(&shared->mutex);
+    shared->refcount++;
+    pthread_mutex_unlock(&shared->mutex);
+
+    dest->shared = shared;
+    dest->nf = shared->nf;
+    dest->der = shared->der;
+}
+
+void _renf_shared_release(renf_t nf)
+{
+    struct renf_shared * shared = nf->shared;
+    slong refcount;
+
+    pthread_mutex_lock(&shared->mutex);
+    refcount = --shared->refcount;
+    pthread_mutex_unlock(&shared->mutex);
+
+    if (refcount == 0)
+    {
+        pthread_mutex_destroy(&shared->mutex);
+        nf_clear(shared->nf);
+        fmpz_poly_clear(shared->der);
+        flint_free(shared);
+    }
+
+    nf->shared = NULL;
+    nf->nf = NULL;
+    nf->der = NULL;
+}
@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+/* The part of a renf_t that is immutable once the field has been created.
+ *
+ * Setting up an nf_t precomputes data for the reduction modulo the defining
+ * polynomial, so instead of recreating it for every copy of a renf_t, the
+ * copies share it. The reference count is protected by a mutex since copies
+ * are typically created and destroyed by different threads. */
+
+#ifndef E_ANTIC_RENF_SHARED_H
+#define E_ANTIC_RENF_SHARED_H
+
+#include <pthread.h>
+
+#include "../../e-antic/renf.h"
+
+struct renf_shared
+{
+    nf_t nf;
+
+    /* The derivative of the numerator of the defining polynomial. */
+    fmpz_poly_t der;
+
+    /* The number of renf_t that refer to this block. */
+    slong refcount;
+
+    pthread_mutex_t mutex;
+};
+
+/* Create the shared part of nf for the defining polynomial pol. */
+void _renf_shared_init(renf_t nf, const fmpq_poly_t pol);
+
+/* Make dest refer to the shared part of src. */
+void _renf_shared_acquire(renf_t dest, const renf_t src);
+
+/* Drop the reference of nf to its shared part and free it if this was the
+ * last reference. */
+void _renf_shared_release(renf_t nf);
+
+#endif
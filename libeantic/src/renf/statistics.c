@@ -0,0 +1,54 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf.h"
+
+#include "statistics.h"
+
+renf_statistics _renf_global_statistics;
+
+void renf_get_statistics(renf_statistics * statistics, const renf_t nf)
+{
+    *statistics = nf->statistics;
+}
+
+void renf_get_global_statistics(renf_statistics * statistics)
+{
+    *statistics = _renf_global_statistics;
+}
+
+void renf_reset_statistics(renf_t nf)
+{
+    memset(&nf->statistics, 0, sizeof(renf_statistics));
+}
+
+void renf_reset_global_statistics(void)
+{
+    memset(&_renf_global_statistics, 0, sizeof(renf_statistics));
+}
+
+void _renf_count_coercion(renf_t nf)
+{
+    RENF_STATISTICS_ADD(nf, coercions);
+}
+
+int renf_statistics_enabled(void)
+{
+#ifdef EANTIC_STATISTICS
+    return 1;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+/* Counting of events for renf_get_statistics().
+ *
+ * The macros below expand to nothing unless e-antic has been configured
+ * with --enable-statistics. The counters of a number field might be updated
+ * from several threads at once, so we use atomic operations where the
+ * compiler provides them. */
+
+#ifndef E_ANTIC_RENF_STATISTICS_H
+#define E_ANTIC_RENF_STATISTICS_H
+
+#include "../../e-antic/renf.h"
+
+#ifdef EANTIC_STATISTICS
+
+static __inline__ void _renf_statistics_add(ulong * counter)
+{
+#if defined(__GNUC__)
+    __atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+#else
+    (*counter)++;
+#endif
+}
+
+static __inline__ void _renf_statistics_max(ulong * counter, ulong value)
+{
+#if defined(__GNUC__)
+    ulong current = __atomic_load_n(counter, __ATOMIC_RELAXED);
+    while (current < value && !__atomic_compare_exchange_n(counter, &current, value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+#else
+    if (*counter < value)
+        *counter = value;
+#endif
+}
+
+/* Count an event in the field nf and in all fields. */
+#define RENF_STATISTICS_ADD(nf, counter) \
+    do { \
+        _renf_statistics_add(&(nf)->statistics.counter); \
+        _renf_statistics_add(&_renf_global_statistics.counter); \
+    } while (0)
+
+/* Count that a predicate in nf recomputed an enclosure at precision prec. */
+#define RENF_STATISTICS_ESCALATE(nf, prec) \
+    do { \
+        RENF_STATISTICS_ADD(nf, escalations); \
+        _renf_statistics_max(&(nf)->statistics.max_prec, (ulong) (prec)); \
+        _renf_statistics_max(&_renf_global_statistics.max_prec, (ulong) (prec)); \
+    } while (0)
+
+#else
+
+#define RENF_STATISTICS_ADD(nf, counter) do { } while (0)
+#define RENF_STATISTICS_ESCALATE(nf, prec) do { } while (0)
+
+#endif
+
+#endif
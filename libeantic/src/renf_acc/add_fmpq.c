@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_acc.h"
+
+void renf_acc_add_fmpq(renf_acc_t acc, const fmpq_t c, const renf_t nf)
+{
+    arb_t t;
+
+    _renf_acc_add_fmpz_poly(acc, fmpq_numref(c), fmpq_is_zero(c) ? 0 : 1, fmpq_denref(c), 1);
+
+    arb_init(t);
+    arb_set_fmpq(t, c, nf->prec);
+    arb_add(acc->emb, acc->emb, t, nf->prec);
+    arb_clear(t);
+}
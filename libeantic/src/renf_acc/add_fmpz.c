@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_acc.h"
+
+void renf_acc_add_fmpz(renf_acc_t acc, const fmpz_t c, const renf_t nf)
+{
+    fmpz_t one;
+    fmpz_init_set_ui(one, 1);
+
+    _renf_acc_add_fmpz_poly(acc, c, fmpz_is_zero(c) ? 0 : 1, one, 1);
+    arb_add_fmpz(acc->emb, acc->emb, c, nf->prec);
+
+    fmpz_clear(one);
+}
@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_acc.h"
+
+void _renf_acc_add_fmpz_poly(renf_acc_t acc, const fmpz * num, slong len, const fmpz_t den, int sign)
+{
+    fmpz_t s;
+
+    if (len == 0)
+        return;
+
+    fmpz_init(s);
+
+    if (fmpz_is_one(den) && fmpz_is_one(&acc->den))
+    {
+        /* Integral terms into an integral accumulator need no scaling. */
+        if (sign > 0)
+            _fmpz_vec_add(acc->num, acc->num, num, len);
+        else
+            _fmpz_vec_sub(acc->num, acc->num, num, len);
+    }
+    else if (fmpz_divisible(&acc->den, den))
+    {
+        /* The common case in a long sum: the term fits the denominator we
+         * already have. */
+        fmpz_divexact(s, &acc->den, den);
+        if (sign > 0)
+            _fmpz_vec_scalar_addmul_fmpz(acc->num, num, len, s);
+        else
+            _fmpz_vec_scalar_submul_fmpz(acc->num, num, len, s);
+    }
+    else
+    {
+        fmpz_t l;
+        fmpz_init(l);
+
+        fmpz_lcm(l, &acc->den, den);
+        fmpz_divexact(s, l, &acc->den);
+        _fmpz_vec_scalar_mul_fmpz(acc->num, acc->num, acc->degree, s);
+        fmpz_swap(&acc->den, l);
+
+        fmpz_divexact(s, &acc->den, den);
+        if (sign > 0)
+            _fmpz_vec_scalar_addmul_fmpz(acc->num, num, len, s);
+        else
+            _fmpz_vec_scalar_submul_fmpz(acc->num, num, len, s);
+
+        fmpz_clear(l);
+    }
+
+    fmpz_clear(s);
+}
@@ -0,0 +1,24 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_acc.h"
+
+void _renf_acc_add_nf_elem(renf_acc_t acc, const nf_elem_t a, int sign, const renf_t nf)
+{
+    if (nf->nf->flag & NF_LINEAR)
+        _renf_acc_add_fmpz_poly(acc, LNF_ELEM_NUMREF(a), 1, LNF_ELEM_DENREF(a), sign);
+    else if (nf->nf->flag & NF_QUADRATIC)
+        _renf_acc_add_fmpz_poly(acc, QNF_ELEM_NUMREF(a), 2, QNF_ELEM_DENREF(a), sign);
+    else
+        _renf_acc_add_fmpz_poly(acc, NF_ELEM_NUMREF(a), NF_ELEM(a)->length, NF_ELEM_DENREF(a), sign);
+}
@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_acc.h"
+
+void renf_acc_addmul(renf_acc_t acc, const renf_elem_t a, const renf_elem_t b, const renf_t nf)
+{
+    nf_elem_t c;
+    nf_elem_init(c, nf->nf);
+
+    nf_elem_mul(c, a->elem, b->elem, nf->nf);
+    _renf_acc_add_nf_elem(acc, c, 1, nf);
+    arb_addmul(acc->emb, a->emb, b->emb, nf->prec);
+
+    nf_elem_clear(c, nf->nf);
+}
@@ -0,0 +1,21 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_acc.h"
+
+void renf_acc_clear(renf_acc_t acc)
+{
+    _fmpz_vec_clear(acc->num, acc->degree);
+    fmpz_clear(&acc->den);
+    arb_clear(acc->emb);
+}
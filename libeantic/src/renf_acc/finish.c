@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_acc.h"
+
+void renf_acc_finish(renf_elem_t res, const renf_acc_t acc, const renf_t nf)
+{
+    nf_elem_struct * a = res->elem;
+
+    if (nf->nf->flag & NF_LINEAR)
+    {
+        fmpz_set(LNF_ELEM_NUMREF(a), acc->num);
+        fmpz_set(LNF_ELEM_DENREF(a), &acc->den);
+    }
+    else if (nf->nf->flag & NF_QUADRATIC)
+    {
+        _fmpz_vec_set(QNF_ELEM_NUMREF(a), acc->num, 2);
+        fmpz_zero(QNF_ELEM_NUMREF(a) + 2);
+        fmpz_set(QNF_ELEM_DENREF(a), &acc->den);
+    }
+    else
+    {
+        fmpq_poly_fit_length(NF_ELEM(a), acc->degree);
+        _fmpz_vec_set(NF_ELEM_NUMREF(a), acc->num, acc->degree);
+        fmpz_set(NF_ELEM_DENREF(a), &acc->den);
+        _fmpq_poly_set_length(NF_ELEM(a), acc->degree);
+        _fmpq_poly_normalise(NF_ELEM(a));
+    }
+
+    /* This is the only canonicalisation of the entire sum. */
+    nf_elem_canonicalise(a, nf->nf);
+
+    /* The enclosure accumulates the errors of all the terms. If it got too
+     * wide to be useful, we rather recompute it from the exact value. */
+    if (arb_rel_accuracy_bits(acc->emb) < nf->prec / 2)
+        renf_elem_set_evaluation(res, nf, nf->prec);
+    else
+        arb_set(res->emb, acc->emb);
+}
@@ -0,0 +1,22 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_acc.h"
+
+void renf_acc_init(renf_acc_t acc, const renf_t nf)
+{
+    acc->degree = fmpq_poly_degree(nf->nf->pol);
+    acc->num = _fmpz_vec_init(acc->degree);
+    fmpz_init_set_ui(&acc->den, 1);
+    arb_init(acc->emb);
+}
@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_cache.h"
+
+ulong _renf_cache_checksum(const char * data, slong len)
+{
+    /* 64-bit (or 32-bit) FNV-1a, which detects accidental damage such as
+       truncated or partially overwritten files. */
+#if FLINT_BITS == 64
+    ulong h = UWORD(14695981039346656037);
+    const ulong prime = UWORD(1099511628211);
+#else
+    ulong h = UWORD(2166136261);
+    const ulong prime = UWORD(16777619);
+#endif
+    slong i;
+
+    for (i = 0; i < len; i++)
+    {
+        h ^= (unsigned char) data[i];
+        h *= prime;
+    }
+
+    return h;
+}
@@ -0,0 +1,30 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_cache.h"
+
+void renf_cache_clear(renf_cache_t cache)
+{
+    slong i;
+
+    for (i = 0; i < cache->length; i++)
+    {
+        flint_free(cache->entries[i].pol);
+        flint_free(cache->entries[i].key);
+        flint_free(cache->entries[i].emb);
+    }
+
+    flint_free(cache->entries);
+    flint_free(cache->path);
+    pthread_mutex_destroy(&cache->mutex);
+}
@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_cache.h"
+
+int renf_cache_get(arb_t res, renf_cache_t cache, const fmpq_poly_t pol, const arb_t emb, slong prec)
+{
+    char * p = fmpq_poly_get_str(pol);
+    char * key = arb_dump_str(emb);
+    int found = 0;
+    slong i;
+
+    pthread_mutex_lock(&cache->mutex);
+
+    for (i = cache->length - 1; i >= 0; i--)
+    {
+        renf_cache_entry * entry = cache->entries + i;
+
+        if (strcmp(entry->key, key) || strcmp(entry->pol, p))
+            continue;
+
+        if (entry->prec >= prec)
+        {
+            /* Do not trust the cache blindly, the embedding must at least
+               be consistent with the one we have been given. */
+            if (arb_load_str(res, entry->emb) == 0 && arb_contains(emb, res))
+            {
+                renf_cache_entry tmp = *entry;
+
+                /* Mark the entry as the most recently used one. */
+                memmove(entry, entry + 1, (cache->length - i - 1) * sizeof(renf_cache_entry));
+                cache->entries[cache->length - 1] = tmp;
+
+                found = 1;
+            }
+            else
+            {
+                _renf_cache_remove(cache, i);
+            }
+        }
+
+        break;
+    }
+
+    pthread_mutex_unlock(&cache->mutex);
+
+    flint_free(p);
+    flint_free(key);
+
+    return found;
+}
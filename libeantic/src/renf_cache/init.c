@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_cache.h"
+
+/* Return a copy of the string s allocated with flint_malloc. */
+static char * copy(const char * s)
+{
+    char * t = (char *) flint_malloc(strlen(s) + 1);
+    strcpy(t, s);
+    return t;
+}
+
+/* Read the entries of a cache file with contents data of length len into
+ * cache. Returns 0 if the data is not a valid cache file. */
+static int parse(renf_cache_t cache, char * data, slong len)
+{
+    const slong header = sizeof(RENF_CACHE_HEADER) - 1;
+    slong body;
+    char * line;
+    char * next;
+    char * end;
+
+    if (len < header || strncmp(data, RENF_CACHE_HEADER, header) || data[len - 1] != '\n')
+        return 0;
+
+    /* The last line holds the checksum of everything before it. */
+    body = len - 1;
+    while (body > header && data[body - 1] != '\n')
+        body--;
+
+    if (strtoull(data + body, &end, 16) != (unsigned long long) _renf_cache_checksum(data, body) || *end != '\n')
+        return 0;
+
+    data[body] = '\0';
+    for (line = data + header; *line != '\0'; line = next)
+    {
+        char * fields[4];
+        slong prec;
+        int i;
+
+        next = strchr(line, '\n');
+        if (next == NULL)
+            return 0;
+        *next++ = '\0';
+
+        fields[0] = line;
+        for (i = 1; i < 4; i++)
+        {
+            fields[i] = strchr(fields[i - 1], '\t');
+            if (fields[i] == NULL)
+                return 0;
+            *fields[i]++ = '\0';
+        }
+
+        prec = strtol(fields[0], &end, 10);
+        if (*end != '\0' || prec <= 0)
+            return 0;
+
+        _renf_cache_push(cache, copy(fields[1]), copy(fields[2]), copy(fields[3]), prec);
+    }
+
+    return 1;
+}
+
+int renf_cache_init(renf_cache_t cache, const char * path, slong limit)
+{
+    FILE * file;
+    char * data;
+    long len;
+    int valid;
+
+    cache->path = copy(path);
+    cache->limit = limit;
+    cache->size = 0;
+    cache->length = 0;
+    cache->alloc = 0;
+    cache->entries = NULL;
+    cache->dirty = 0;
+    pthread_mutex_init(&cache->mutex, NULL);
+
+    file = fopen(path, "rb");
+    if (file == NULL)
+        return 0;
+
+    if (fseek(file, 0, SEEK_END) || (len = ftell(file)) < 0 || fseek(file, 0, SEEK_SET))
+    {
+        fclose(file);
+        return 0;
+    }
+
+    data = (char *) flint_malloc(len + 1);
+    valid = fread(data, 1, len, file) == (size_t) len;
+    fclose(file);
+
+    if (valid)
+    {
+        data[len] = '\0';
+        valid = parse(cache, data, len);
+    }
+
+    flint_free(data);
+
+    if (!valid)
+    {
+        while (cache->length)
+            _renf_cache_remove(cache, cache->length - 1);
+    }
+
+    cache->dirty = 0;
+
+    return valid;
+}
@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_cache.h"
+
+void _renf_cache_push(renf_cache_t cache, char * pol, char * key, char * emb, slong prec)
+{
+    renf_cache_entry * entry;
+
+    if (cache->length == cache->alloc)
+    {
+        cache->alloc = FLINT_MAX(1, 2 * cache->alloc);
+        cache->entries = (renf_cache_entry *) flint_realloc(cache->entries, cache->alloc * sizeof(renf_cache_entry));
+    }
+
+    entry = cache->entries + cache->length;
+    entry->prec = prec;
+    entry->pol = pol;
+    entry->key = key;
+    entry->emb = emb;
+    entry->size = snprintf(NULL, 0, "%ld\t%s\t%s\t%s\n", (long) prec, pol, key, emb);
+
+    cache->length++;
+    cache->size += entry->size;
+    cache->dirty = 1;
+
+    while (cache->length && RENF_CACHE_OVERHEAD + cache->size > cache->limit)
+        _renf_cache_remove(cache, 0);
+}
@@ -0,0 +1,30 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_cache.h"
+
+void _renf_cache_remove(renf_cache_t cache, slong i)
+{
+    renf_cache_entry * entry = cache->entries + i;
+
+    flint_free(entry->pol);
+    flint_free(entry->key);
+    flint_free(entry->emb);
+
+    cache->size -= entry->size;
+    cache->length--;
+    memmove(entry, entry + 1, (cache->length - i) * sizeof(renf_cache_entry));
+    cache->dirty = 1;
+}
@@ -0,0 +1,45 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_cache.h"
+
+void renf_cache_set(renf_cache_t cache, const fmpq_poly_t pol, const arb_t emb, const arb_t res, slong prec)
+{
+    char * p;
+    char * key;
+    slong i;
+
+    /* Such an entry would be rejected by renf_cache_get(). */
+    if (!arb_contains(emb, res))
+        return;
+
+    p = fmpq_poly_get_str(pol);
+    key = arb_dump_str(emb);
+
+    pthread_mutex_lock(&cache->mutex);
+
+    for (i = 0; i < cache->length; i++)
+    {
+        if (!strcmp(cache->entries[i].key, key) && !strcmp(cache->entries[i].pol, p))
+        {
+            _renf_cache_remove(cache, i);
+            break;
+        }
+    }
+
+    _renf_cache_push(cache, p, key, arb_dump_str(res), prec);
+
+    pthread_mutex_unlock(&cache->mutex);
+}
@@ -0,0 +1,28 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_cache.h"
+
+static renf_cache * renf_cache_installed = NULL;
+
+renf_cache * renf_set_cache(renf_cache * cache)
+{
+    renf_cache * previous = renf_cache_installed;
+    renf_cache_installed = cache;
+    return previous;
+}
+
+renf_cache * renf_get_cache(void)
+{
+    return renf_cache_installed;
+}
@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_cache.h"
+
+int renf_cache_write(renf_cache_t cache)
+{
+    FILE * file;
+    char * data;
+    char * tmp;
+    slong len, i;
+    int success;
+
+    pthread_mutex_lock(&cache->mutex);
+
+    if (!cache->dirty)
+    {
+        pthread_mutex_unlock(&cache->mutex);
+        return 1;
+    }
+
+    data = (char *) flint_malloc(sizeof(RENF_CACHE_HEADER) + cache->size);
+    strcpy(data, RENF_CACHE_HEADER);
+    len = sizeof(RENF_CACHE_HEADER) - 1;
+    for (i = 0; i < cache->length; i++)
+    {
+        const renf_cache_entry * entry = cache->entries + i;
+        len += sprintf(data + len, "%ld\t%s\t%s\t%s\n", (long) entry->prec, entry->pol, entry->key, entry->emb);
+    }
+
+    /* We write to a temporary file first and then move it into place so the
+       file at path is always complete. */
+    tmp = (char *) flint_malloc(strlen(cache->path) + 5);
+    strcpy(tmp, cache->path);
+    strcat(tmp, ".tmp");
+
+    file = fopen(tmp, "wb");
+    success = file != NULL;
+    if (success)
+    {
+        success = fwrite(data, 1, len, file) == (size_t) len;
+        success = fprintf(file, "%016llx\n", (unsigned long long) _renf_cache_checksum(data, len)) > 0 && success;
+        success = fclose(file) == 0 && success;
+
+        if (success && rename(tmp, cache->path))
+        {
+            /* On some platforms, rename() does not replace existing files. */
+            remove(cache->path);
+            success = rename(tmp, cache->path) == 0;
+        }
+
+        if (!success)
+            remove(tmp);
+    }
+
+    if (success)
+        cache->dirty = 0;
+
+    flint_free(tmp);
+    flint_free(data);
+
+    pthread_mutex_unlock(&cache->mutex);
+
+    return success;
+}
@@ -14,11 +14,15 @@
 #include "../../e-antic/config.h"
 
 #include "../../e-antic/renf_elem.h"
+#include "../../e-antic/renf_trace.h"
+
+#include "../renf/statistics.h"
 
 int renf_elem_cmp(renf_elem_t a, renf_elem_t b, renf_t nf)
 {
     renf_elem_t diff;
     slong prec, conda, condb;
+    ulong start;
     int s;
 
     /* equality */
@@ -26,9 +30,15 @@ int renf_elem_cmp(renf_elem_t a, renf_elem_t b, renf_t nf)
 
     /* compare enclosures */
     if (arb_lt(a->emb, b->emb))
+    {
+        _renf_record_predicate(nf, 0);
         return -1;
+    }
     if (arb_gt(a->emb, b->emb))
+    {
+        _renf_record_predicate(nf, 0);
         return 1;
+    }
 
     /* rationals */
     if (nf_elem_is_rational(a->elem, nf->nf) &&
@@ -61,6 +71,8 @@ int renf_elem_cmp(renf_elem_t a, renf_elem_t b, renf_t nf)
     }
 
     /* try better enclosures */
+    _renf_record_predicate(nf, 1);
+    start = _renf_trace_start();
     prec = FLINT_MAX(nf->prec, arb_rel_accuracy_bits(nf->emb));
 
     renf_elem_relative_condition_number_2exp(&conda, a, nf);
@@ -69,12 +81,16 @@ int renf_elem_cmp(renf_elem_t a, renf_elem_t b, renf_t nf)
     renf_elem_relative_condition_number_2exp(&condb, b, nf);
     renf_elem_set_evaluation(b, nf, prec + condb);
 
+    RENF_STATISTICS_ESCALATE(nf, prec + FLINT_MAX(conda, condb));
+    _renf_trace(RENF_TRACE_ESCALATION, nf, nf->prec, prec + FLINT_MAX(conda, condb), start);
+
     if (arb_lt(a->emb, b->emb))
         return -1;
     if (arb_gt(a->emb, b->emb))
         return 1;
 
     /* sign of the difference */
+    RENF_STATISTICS_ADD(nf, cmp_differences);
     renf_elem_init(diff, nf);
     renf_elem_sub(diff, a, b, nf);
     s = renf_elem_sgn(diff, nf);
@@ -15,11 +15,15 @@
 #include "../../e-antic/config.h"
 
 #include "../../e-antic/renf_elem.h"
+#include "../../e-antic/renf_trace.h"
+
+#include "../renf/statistics.h"
 
 int renf_elem_cmp_fmpq(renf_elem_t a, const fmpq_t b, renf_t nf)
 {
     int s;
     slong prec, cond;
+    ulong start;
     arb_t diffball;
     renf_elem_t diffnf;
 
@@ -54,21 +58,28 @@ int renf_elem_cmp_fmpq(renf_elem_t a, const fmpq_t b, renf_t nf)
 
     if (!arb_contains_zero(diffball))
     {
+        _renf_record_predicate(nf, 0);
         s = arf_sgn(arb_midref(diffball));
         arb_clear(diffball);
         return s;
     }
 
+    _renf_record_predicate(nf, 1);
+    start = _renf_trace_start();
+
     renf_elem_relative_condition_number_2exp(&cond, a, nf);
     prec = FLINT_MAX(nf->prec, arb_rel_accuracy_bits(nf->emb));
 
     assert(prec != -cond && "prec + cond == 0 which does not make sense. In mid 2020 we found this to be the case sometimes. Unfortunately, we never managed to debug this issue. The only reproducer needed several days of computation to get here. So if this happens to you, please let us know.");
 
+    RENF_STATISTICS_ESCALATE(nf, prec + cond);
     renf_elem_set_evaluation(a, nf, prec + cond);
 
     arb_set_fmpq(diffball, b, prec);
     arb_sub(diffball, a->emb, diffball, prec);
 
+    _renf_trace(RENF_TRACE_ESCALATION, nf, nf->prec, prec + cond, start);
+
     if (!arb_contains_zero(diffball))
     {
         s = arf_sgn(arb_midref(diffball));
@@ -11,6 +11,8 @@
 
 #include "../../e-antic/config.h"
 
+#include "../renf/statistics.h"
+
 #define KIND floor
 #define ARF_INT arf_floor
 #define FMPZ_DIV fmpz_fdiv_q
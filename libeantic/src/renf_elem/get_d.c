@@ -16,6 +16,8 @@
 
 #include "../../e-antic/renf_elem.h"
 
+#include "../renf/statistics.h"
+
 #if FLT_RADIX != 2
 #error "not implemented: doubles that are not binary internally"
 #endif
@@ -108,12 +110,16 @@ double renf_elem_get_d(renf_elem_t a, renf_t nf, arf_rnd_t rnd)
         if (arb_rel_accuracy_bits(a->emb) < DBL_MANT_DIG + 2)
         {
             if(2 * arf_bits(arb_midref(a->emb)) < prec)
+            {
+                RENF_STATISTICS_ESCALATE(nf, prec);
                 renf_elem_set_evaluation(a, nf, prec);
+            }
 
             while (arb_rel_accuracy_bits(a->emb) < DBL_MANT_DIG + 2)
             {
                 prec *= 2;
                 renf_refine_embedding(nf, prec);
+                RENF_STATISTICS_ESCALATE(nf, prec);
                 renf_elem_set_evaluation(a, nf, prec);
             }
         }
@@ -140,6 +146,7 @@ double renf_elem_get_d(renf_elem_t a, renf_t nf, arf_rnd_t rnd)
 
             prec *= 2;
             renf_refine_embedding(nf, prec);
+            RENF_STATISTICS_ESCALATE(nf, prec);
             renf_elem_set_evaluation(a, nf, prec);
         }
 
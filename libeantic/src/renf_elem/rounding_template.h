@@ -12,6 +12,7 @@
 #include <stdlib.h>
 
 #include "../../e-antic/renf_elem.h"
+#include "../../e-antic/renf_trace.h"
 
 #ifdef KIND
 
@@ -45,6 +46,7 @@ RENF_ELEM_INT(fmpz_t a, renf_elem_t b, renf_t nf)
     arf_t cl, cr;
     slong size, cond = WORD_MIN, prec;
     fmpz_t zsize;
+    ulong start;
 
     if (nf_elem_is_rational(b->elem, nf->nf))
     {
@@ -62,12 +64,14 @@ RENF_ELEM_INT(fmpz_t a, renf_elem_t b, renf_t nf)
     {
         renf_elem_relative_condition_number_2exp(&cond, b, nf);
         prec = FLINT_MAX(nf->prec, arb_rel_accuracy_bits(nf->emb));
+        RENF_STATISTICS_ESCALATE(nf, prec + cond);
         renf_elem_set_evaluation(b, nf, prec + cond);
 
         while (arf_is_inf(arb_midref(b->emb)) || mag_is_inf(arb_radref(b->emb)))
         {
             prec *= 2;
             renf_refine_embedding(nf, prec);
+            RENF_STATISTICS_ESCALATE(nf, prec + cond);
             renf_elem_set_evaluation(b, nf, prec + cond);
         }
     }
@@ -98,14 +102,17 @@ RENF_ELEM_INT(fmpz_t a, renf_elem_t b, renf_t nf)
     fmpz_clear(zsize);
 
     prec = FLINT_MAX(nf->prec, arb_rel_accuracy_bits(nf->emb));
+    start = _renf_trace_start();
 
     if (cond == WORD_MIN)
         renf_elem_relative_condition_number_2exp(&cond, b, nf);
 
     do {
+        RENF_STATISTICS_ESCALATE(nf, prec + cond);
         renf_elem_set_evaluation(b, nf, prec + cond);
         if (ARB_UNIQUE_INT(a, b->emb, cl, cr, FLINT_MAX(size, prec)))
         {
+            _renf_trace(RENF_TRACE_ESCALATION, nf, nf->prec, prec + cond, start);
             arf_clear(cl);
             arf_clear(cr);
             return;
@@ -12,11 +12,15 @@
 #include "../../e-antic/config.h"
 
 #include "../../e-antic/renf_elem.h"
+#include "../../e-antic/renf_trace.h"
+
+#include "../renf/statistics.h"
 
 int renf_elem_sgn(renf_elem_t a, renf_t nf)
 {
     slong prec;
     slong cond;
+    ulong start;
 
     if (nf_elem_is_rational(a->elem, nf->nf))
     {
@@ -31,19 +35,30 @@ int renf_elem_sgn(renf_elem_t a, renf_t nf)
     }
 
     if (!arb_contains_zero(a->emb))
+    {
+        _renf_record_predicate(nf, 0);
         return arf_sgn(arb_midref(a->emb));
+    }
+
+    _renf_record_predicate(nf, 1);
+    start = _renf_trace_start();
 
     renf_elem_relative_condition_number_2exp(&cond, a, nf);
     prec = FLINT_MAX(nf->prec, arb_rel_accuracy_bits(nf->emb));
+    RENF_STATISTICS_ESCALATE(nf, prec + cond);
     renf_elem_set_evaluation(a, nf, prec + cond);
 
     do
     {
         if (!arb_contains_zero(a->emb))
+        {
+            _renf_trace(RENF_TRACE_ESCALATION, nf, nf->prec, prec + cond, start);
             return arf_sgn(arb_midref(a->emb));
+        }
 
         prec *= 2;
         renf_refine_embedding(nf, prec);
+        RENF_STATISTICS_ESCALATE(nf, prec + cond);
         renf_elem_set_evaluation(a, nf, prec + cond);
     } while(1);
 }
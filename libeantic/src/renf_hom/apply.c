@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_hom.h"
+
+void renf_hom_apply(renf_elem_t res, const renf_elem_t a, const renf_hom_t f, const renf_t K, renf_t L)
+{
+    fmpq_poly_t p, q;
+    slong m = fmpz_mat_nrows(f->num);
+    slong i, j;
+
+    fmpq_poly_init(p);
+    nf_elem_get_fmpq_poly(p, a->elem, K->nf);
+
+    if (fmpq_poly_length(p) <= 1)
+    {
+        /* Rationals are mapped to themselves. */
+        renf_elem_set_fmpq_poly(res, p, L);
+        fmpq_poly_clear(p);
+        return;
+    }
+
+    fmpq_poly_init2(q, m);
+    for (i = 0; i < m; i++)
+    {
+        fmpz_zero(fmpq_poly_numref(q) + i);
+        for (j = 0; j < fmpq_poly_length(p); j++)
+            fmpz_addmul(fmpq_poly_numref(q) + i, fmpz_mat_entry(f->num, i, j), fmpq_poly_numref(p) + j);
+    }
+    fmpz_mul(fmpq_poly_denref(q), f->den, fmpq_poly_denref(p));
+    _fmpq_poly_set_length(q, m);
+    fmpq_poly_canonicalise(q);
+
+    renf_elem_set_fmpq_poly(res, q, L);
+
+    fmpq_poly_clear(p);
+    fmpq_poly_clear(q);
+}
@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_hom.h"
+
+/* Return whether `image` is a root of the defining polynomial of K. */
+static int renf_hom_is_root(renf_t K, const renf_elem_t image, renf_t L)
+{
+    renf_elem_t y;
+    fmpq_t c;
+    slong i;
+    int is_root;
+
+    renf_elem_init(y, L);
+    fmpq_init(c);
+
+    renf_elem_zero(y, L);
+    for (i = fmpq_poly_degree(K->nf->pol); i >= 0; i--)
+    {
+        renf_elem_mul(y, y, image, L);
+        fmpq_poly_get_coeff_fmpq(c, K->nf->pol, i);
+        renf_elem_add_fmpq(y, y, c, L);
+    }
+
+    is_root = renf_elem_is_zero(y, L);
+
+    renf_elem_clear(y, L);
+    fmpq_clear(c);
+
+    return is_root;
+}
+
+/* Return whether the root `image` of the defining polynomial of K is the
+ * root that defines the embedding of K. The embedding of K isolates a unique
+ * root. This root is irrational so it lies in the interior of that ball and
+ * refining the enclosure of `image` eventually shows whether it is in the
+ * ball or outside of it. */
+static int renf_hom_is_embedding(renf_t K, const renf_elem_t image, renf_t L)
+{
+    renf_elem_t y;
+    slong prec, cond;
+    int is_embedding;
+
+    renf_elem_init(y, L);
+    renf_elem_set(y, image, L);
+
+    renf_elem_relative_condition_number_2exp(&cond, y, L);
+    prec = FLINT_MAX(L->prec, arb_rel_accuracy_bits(L->emb));
+
+    while (1)
+    {
+        if (arb_contains(K->emb, y->emb))
+        {
+            is_embedding = 1;
+            break;
+        }
+        if (!arb_overlaps(K->emb, y->emb))
+        {
+            is_embedding = 0;
+            break;
+        }
+
+        prec *= 2;
+        renf_refine_embedding(L, prec);
+        renf_elem_set_evaluation(y, L, prec + cond);
+    }
+
+    renf_elem_clear(y, L);
+
+    return is_embedding;
+}
+
+int renf_hom_init(renf_hom_t f, renf_t K, const renf_elem_t image, renf_t L)
+{
+    slong n = fmpq_poly_degree(K->nf->pol);
+    slong m = fmpq_poly_degree(L->nf->pol);
+    slong i, j;
+    renf_elem_t power;
+    fmpq_poly_t * images;
+    fmpz_t s;
+
+    if (!renf_hom_is_root(K, image, L))
+        return 0;
+
+    if (n > 1 && !renf_hom_is_embedding(K, image, L))
+        return 0;
+
+    /* Compute the images of 1, x, …, x^{n-1} and their common denominator. */
+    images = flint_malloc(n * sizeof(fmpq_poly_t));
+    renf_elem_init(power, L);
+    renf_elem_one(power, L);
+
+    fmpz_init(f->den);
+    fmpz_one(f->den);
+    for (j = 0; j < n; j++)
+    {
+        fmpq_poly_init(images[j]);
+        nf_elem_get_fmpq_poly(images[j], power->elem, L->nf);
+        fmpz_lcm(f->den, f->den, fmpq_poly_denref(images[j]));
+
+        if (j + 1 < n)
+            renf_elem_mul(power, power, image, L);
+    }
+
+    fmpz_mat_init(f->num, m, n);
+    fmpz_init(s);
+    for (j = 0; j < n; j++)
+    {
+        fmpz_divexact(s, f->den, fmpq_poly_denref(images[j]));
+        for (i = 0; i < fmpq_poly_length(images[j]); i++)
+            fmpz_mul(fmpz_mat_entry(f->num, i, j), fmpq_poly_numref(images[j]) + i, s);
+        fmpq_poly_clear(images[j]);
+    }
+
+    fmpz_clear(s);
+    flint_free(images);
+    renf_elem_clear(power, L);
+
+    return 1;
+}
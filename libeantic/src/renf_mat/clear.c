@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+void renf_mat_clear(renf_mat_t mat, const renf_t nf)
+{
+    slong i;
+
+    /* The rows might have been permuted so we go through the entries directly. */
+    for (i = 0; i < mat->r * mat->c; i++)
+        renf_elem_clear(mat->entries + i, nf);
+
+    flint_free(mat->entries);
+    flint_free(mat->rows);
+}
@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+/* The fraction-free elimination performs O(n^3) multiplications of number
+ * field elements whose coefficients grow linearly with the size of the
+ * matrix. For larger matrices, the modular approach wins. */
+#define RENF_MAT_DET_MULTIMOD_CUTOFF 8
+
+void renf_mat_det(renf_elem_t det, const renf_mat_t A, renf_t nf)
+{
+    if (fmpq_poly_degree(nf->nf->pol) > 1 && A->r >= RENF_MAT_DET_MULTIMOD_CUTOFF)
+        renf_mat_det_multimod(det, A, nf);
+    else
+        renf_mat_det_bareiss(det, A, nf);
+}
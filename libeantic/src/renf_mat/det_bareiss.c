@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <flint/perm.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+void renf_mat_det_bareiss(renf_elem_t det, const renf_mat_t A, renf_t nf)
+{
+    slong i, n;
+    slong * perm;
+    renf_mat_t B;
+
+    n = A->r;
+
+    if (n != A->c)
+    {
+        fprintf(stderr, "renf_mat_det_bareiss: non-square matrix\n");
+        abort();
+    }
+
+    if (n == 0)
+    {
+        renf_elem_one(det, nf);
+        return;
+    }
+
+    perm = (slong *) flint_malloc(n * sizeof(slong));
+    for (i = 0; i < n; i++)
+        perm[i] = i;
+
+    renf_mat_init(B, n, n, nf);
+
+    /* With full rank, the last pivot of the fraction-free elimination is the
+     * determinant of the permuted matrix. */
+    if (renf_mat_fflu(B, det, perm, A, 1, nf) == n && _perm_parity(perm, n))
+        renf_elem_neg(det, det, nf);
+
+    renf_mat_clear(B, nf);
+    flint_free(perm);
+}
@@ -0,0 +1,182 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <flint/perm.h>
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+/* Set det to the determinant of A. The matrix A is overwritten with its LU
+ * decomposition. */
+static void fq_nmod_mat_det_lu(fq_nmod_t det, fq_nmod_mat_t A, const fq_nmod_ctx_t ctx)
+{
+    slong i;
+    const slong n = A->r;
+    slong * perm = _perm_init(n);
+
+    if (fq_nmod_mat_lu(perm, A, 1, ctx) < n)
+    {
+        fq_nmod_zero(det, ctx);
+    }
+    else
+    {
+        fq_nmod_one(det, ctx);
+        for (i = 0; i < n; i++)
+            fq_nmod_mul(det, det, fq_nmod_mat_entry(A, i, i), ctx);
+        if (_perm_parity(perm, n))
+            fq_nmod_neg(det, det, ctx);
+    }
+
+    _perm_clear(perm);
+}
+
+void renf_mat_det_multimod(renf_elem_t det, const renf_mat_t A, renf_t nf)
+{
+    slong i, k, n, d, e, bits;
+    fmpz * num;
+    fmpz * den;
+    fmpz * res;
+    fmpz_t M, ae;
+    fmpz_poly_t F;
+    fmpq_poly_t D;
+    ulong p;
+
+    n = A->r;
+
+    if (n != A->c)
+    {
+        fprintf(stderr, "renf_mat_det_multimod: non-square matrix\n");
+        abort();
+    }
+
+    if (n == 0)
+    {
+        renf_elem_one(det, nf);
+        return;
+    }
+
+    fmpz_poly_init(F);
+    _renf_mat_defining_poly(F, nf);
+    d = fmpz_poly_degree(F);
+
+    num = _fmpz_vec_init(n * n * d);
+    den = _fmpz_vec_init(n);
+    res = _fmpz_vec_init(d);
+    fmpz_init(M);
+    fmpz_init(ae);
+
+    _renf_mat_get_fmpz_rows(num, den, A, nf);
+
+    /* The determinant of the matrix of integer polynomials is a polynomial
+     * P of degree at most n(d - 1). We recover R = lc(F)^e (P mod F) which
+     * has integer coefficients. Since R and its denominator are known a
+     * priori, no rational reconstruction is needed; symmetric CRT suffices
+     * once the product of the primes exceeds twice the bound on R. */
+    e = FLINT_MAX(0, n * (d - 1) - d + 1);
+    bits = _renf_mat_prem_bits(_renf_mat_hadamard_bits(num, n, n, d), n * (d - 1), F) + 2;
+
+    fmpz_pow_ui(ae, fmpz_poly_lead(F), e);
+
+    fmpz_one(M);
+    p = UWORD(1) << (FLINT_BITS - 2);
+
+    while (fmpz_bits(M) <= bits)
+    {
+        _renf_mat_prime_t P;
+        nmod_poly_t r;
+        ulong * values;
+        ulong ae_p;
+
+        if (!_renf_mat_prime_init(P, p, F))
+        {
+            /* No suitable primes for this field, fall back to elimination
+             * over the number field. */
+            _fmpz_vec_clear(num, n * n * d);
+            _fmpz_vec_clear(den, n);
+            _fmpz_vec_clear(res, d);
+            fmpz_clear(M);
+            fmpz_clear(ae);
+            fmpz_poly_clear(F);
+            renf_mat_det_bareiss(det, A, nf);
+            return;
+        }
+
+        p = P->p;
+        values = (ulong *) flint_malloc(d * sizeof(ulong));
+        nmod_poly_init(r, p);
+
+        if (P->split)
+        {
+            nmod_mat_struct * mats = (nmod_mat_struct *) flint_malloc(d * sizeof(nmod_mat_struct));
+
+            for (k = 0; k < d; k++)
+                nmod_mat_init(mats + k, n, n, p);
+
+            _renf_mat_prime_reduce_mat(mats, NULL, num, n, n, P);
+
+            for (k = 0; k < d; k++)
+            {
+                values[k] = nmod_mat_det(mats + k);
+                nmod_mat_clear(mats + k);
+            }
+
+            flint_free(mats);
+
+            _renf_mat_prime_lift(r, values, NULL, P);
+        }
+        else
+        {
+            fq_nmod_mat_t mat;
+            fq_nmod_t value;
+
+            fq_nmod_mat_init(mat, n, n, P->ctx);
+            fq_nmod_init(value, P->ctx);
+
+            _renf_mat_prime_reduce_mat(NULL, mat, num, n, n, P);
+            fq_nmod_mat_det_lu(value, mat, P->ctx);
+
+            _renf_mat_prime_lift(r, NULL, value, P);
+
+            fq_nmod_clear(value, P->ctx);
+            fq_nmod_mat_clear(mat, P->ctx);
+        }
+
+        ae_p = fmpz_fdiv_ui(ae, p);
+        for (k = 0; k < d; k++)
+            fmpz_CRT_ui(res + k, res + k, M, n_mulmod2_preinv(nmod_poly_get_coeff_ui(r, k), ae_p, r->mod.n, r->mod.ninv), p, 1);
+        fmpz_mul_ui(M, M, p);
+
+        nmod_poly_clear(r);
+        flint_free(values);
+        _renf_mat_prime_clear(P);
+    }
+
+    /* Divide by the denominators that we multiplied with. */
+    fmpq_poly_init(D);
+    fmpq_poly_fit_length(D, d);
+    _fmpz_vec_set(fmpq_poly_numref(D), res, d);
+    _fmpq_poly_set_length(D, d);
+    fmpz_set(fmpq_poly_denref(D), ae);
+    for (i = 0; i < n; i++)
+        fmpz_mul(fmpq_poly_denref(D), fmpq_poly_denref(D), den + i);
+    fmpq_poly_canonicalise(D);
+
+    renf_elem_set_fmpq_poly(det, D, nf);
+
+    fmpq_poly_clear(D);
+    _fmpz_vec_clear(num, n * n * d);
+    _fmpz_vec_clear(den, n);
+    _fmpz_vec_clear(res, d);
+    fmpz_clear(M);
+    fmpz_clear(ae);
+    fmpz_poly_clear(F);
+}
@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+int renf_mat_equal(const renf_mat_t mat1, const renf_mat_t mat2, const renf_t nf)
+{
+    slong i, j;
+
+    if (mat1->r != mat2->r || mat1->c != mat2->c)
+        return 0;
+
+    for (i = 0; i < mat1->r; i++)
+        for (j = 0; j < mat1->c; j++)
+            if (!nf_elem_equal(renf_mat_entry(mat1, i, j)->elem, renf_mat_entry(mat2, i, j)->elem, nf->nf))
+                return 0;
+
+    return 1;
+}
@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+slong renf_mat_fflu(renf_mat_t B, renf_elem_t den, slong * perm, const renf_mat_t A, int rank_check, renf_t nf)
+{
+    slong m, n, rank, r, c, i, j;
+    nf_elem_t t, u, inv;
+
+    renf_mat_set(B, A, nf);
+
+    m = B->r;
+    n = B->c;
+    rank = 0;
+
+    nf_elem_init(t, nf->nf);
+    nf_elem_init(u, nf->nf);
+    nf_elem_init(inv, nf->nf);
+
+    nf_elem_one(inv, nf->nf);
+    renf_elem_one(den, nf);
+
+    for (r = 0, c = 0; r < m && c < n; c++)
+    {
+        for (i = r; i < m; i++)
+            if (!nf_elem_is_zero(renf_mat_entry(B, i, c)->elem, nf->nf))
+                break;
+
+        if (i == m)
+        {
+            /* Without this column, the remaining columns are too few to
+             * find a pivot in each of the remaining rows. */
+            if (rank_check && n - c - 1 < m - r)
+            {
+                rank = 0;
+                renf_elem_zero(den, nf);
+                goto cleanup;
+            }
+            continue;
+        }
+
+        renf_mat_swap_rows(B, perm, r, i);
+
+        /* Bareiss' update: every entry below and to the right of the pivot
+         * becomes a minor of A. Unlike for integer matrices, division is
+         * always exact in a field. But it is costly, so we only invert the
+         * previous pivot once and multiply by its inverse. */
+        for (i = r + 1; i < m; i++)
+        {
+            const nf_elem_struct * pivot = renf_mat_entry(B, r, c)->elem;
+            const int eliminate = !nf_elem_is_zero(renf_mat_entry(B, i, c)->elem, nf->nf);
+
+            for (j = c + 1; j < n; j++)
+            {
+                nf_elem_mul(t, pivot, renf_mat_entry(B, i, j)->elem, nf->nf);
+                if (eliminate)
+                {
+                    nf_elem_mul(u, renf_mat_entry(B, i, c)->elem, renf_mat_entry(B, r, j)->elem, nf->nf);
+                    nf_elem_sub(t, t, u, nf->nf);
+                }
+
+                if (r == 0)
+                    nf_elem_swap(renf_mat_entry(B, i, j)->elem, t, nf->nf);
+                else
+                    nf_elem_mul(renf_mat_entry(B, i, j)->elem, t, inv, nf->nf);
+            }
+
+            nf_elem_zero(renf_mat_entry(B, i, c)->elem, nf->nf);
+        }
+
+        nf_elem_set(den->elem, renf_mat_entry(B, r, c)->elem, nf->nf);
+        if (r + 1 < m)
+            nf_elem_inv(inv, den->elem, nf->nf);
+
+        rank++;
+        r++;
+    }
+
+    if (rank_check && rank < m)
+    {
+        rank = 0;
+        renf_elem_zero(den, nf);
+    }
+
+cleanup:
+    nf_elem_clear(t, nf->nf);
+    nf_elem_clear(u, nf->nf);
+    nf_elem_clear(inv, nf->nf);
+
+    renf_elem_set_evaluation(den, nf, nf->prec);
+    _renf_mat_set_evaluation(B, nf);
+
+    return rank;
+}
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+void renf_mat_init(renf_mat_t mat, slong rows, slong cols, const renf_t nf)
+{
+    slong i;
+
+    if (rows < 0 || cols < 0)
+    {
+        fprintf(stderr, "renf_mat_init: negative dimensions\n");
+        abort();
+    }
+
+    mat->r = rows;
+    mat->c = cols;
+    mat->entries = NULL;
+    mat->rows = NULL;
+
+    if (rows * cols != 0)
+    {
+        mat->entries = (renf_elem *) flint_malloc(rows * cols * sizeof(renf_elem));
+        for (i = 0; i < rows * cols; i++)
+            renf_elem_init(mat->entries + i, nf);
+    }
+
+    if (rows != 0)
+    {
+        mat->rows = (renf_elem **) flint_malloc(rows * sizeof(renf_elem *));
+        for (i = 0; i < rows; i++)
+            mat->rows[i] = mat->entries + i * cols;
+    }
+}
@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+int renf_mat_is_zero(const renf_mat_t mat, const renf_t nf)
+{
+    slong i;
+
+    for (i = 0; i < mat->r * mat->c; i++)
+        if (!nf_elem_is_zero(mat->entries[i].elem, nf->nf))
+            return 0;
+
+    return 1;
+}
@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+/* Below this dimension, the overhead of reducing modulo several primes and
+ * reconstructing the result outweighs the savings of avoiding number field
+ * arithmetic. */
+#define RENF_MAT_MUL_MULTIMOD_CUTOFF 16
+
+void renf_mat_mul(renf_mat_t C, const renf_mat_t A, const renf_mat_t B, renf_t nf)
+{
+    if (fmpq_poly_degree(nf->nf->pol) > 1 && FLINT_MIN(FLINT_MIN(A->r, A->c), B->c) >= RENF_MAT_MUL_MULTIMOD_CUTOFF)
+        renf_mat_mul_multimod(C, A, B, nf);
+    else
+        renf_mat_mul_classical(C, A, B, nf);
+}
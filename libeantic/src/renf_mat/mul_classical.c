@@ -0,0 +1,66 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+void renf_mat_mul_classical(renf_mat_t C, const renf_mat_t A, const renf_mat_t B, renf_t nf)
+{
+    slong i, j, k;
+    nf_elem_t s, t;
+
+    if (A->c != B->r || C->r != A->r || C->c != B->c)
+    {
+        fprintf(stderr, "renf_mat_mul_classical: incompatible dimensions\n");
+        abort();
+    }
+
+    if (C == A || C == B)
+    {
+        renf_mat_t T;
+        renf_mat_init(T, C->r, C->c, nf);
+        renf_mat_mul_classical(T, A, B, nf);
+        renf_mat_swap(C, T);
+        renf_mat_clear(T, nf);
+        return;
+    }
+
+    nf_elem_init(s, nf->nf);
+    nf_elem_init(t, nf->nf);
+
+    /* We work with the exact values only and compute the enclosures once
+     * in the end. Updating the enclosures for each product would be
+     * considerably more expensive. */
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < B->c; j++)
+        {
+            nf_elem_zero(s, nf->nf);
+
+            for (k = 0; k < A->c; k++)
+            {
+                if (nf_elem_is_zero(renf_mat_entry(A, i, k)->elem, nf->nf))
+                    continue;
+
+                nf_elem_mul(t, renf_mat_entry(A, i, k)->elem, renf_mat_entry(B, k, j)->elem, nf->nf);
+                nf_elem_add(s, s, t, nf->nf);
+            }
+
+            nf_elem_swap(renf_mat_entry(C, i, j)->elem, s, nf->nf);
+        }
+    }
+
+    nf_elem_clear(s, nf->nf);
+    nf_elem_clear(t, nf->nf);
+
+    _renf_mat_set_evaluation(C, nf);
+}
@@ -0,0 +1,261 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+/* Return the number of bits of the largest 1-norm of the len integer
+ * polynomials of length d stored consecutively in num. */
+static slong max_norm1_bits(const fmpz * num, slong len, slong d)
+{
+    slong i, k, bits = 0;
+    fmpz_t t;
+
+    fmpz_init(t);
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz_zero(t);
+        for (k = 0; k < d; k++)
+        {
+            if (fmpz_sgn(num + i * d + k) >= 0)
+                fmpz_add(t, t, num + i * d + k);
+            else
+                fmpz_sub(t, t, num + i * d + k);
+        }
+        bits = FLINT_MAX(bits, fmpz_bits(t));
+    }
+
+    fmpz_clear(t);
+
+    return bits;
+}
+
+void renf_mat_mul_multimod(renf_mat_t C, const renf_mat_t A, const renf_mat_t B, renf_t nf)
+{
+    slong i, j, k, m, n, l, d, e, bits;
+    fmpz * anum;
+    fmpz * aden;
+    fmpz * bnum;
+    fmpz * bden;
+    fmpz * res;
+    fmpz_t M, ae, bd, t;
+    fmpz_poly_t F;
+    fmpq_poly_t c;
+    ulong p;
+
+    if (A->c != B->r || C->r != A->r || C->c != B->c)
+    {
+        fprintf(stderr, "renf_mat_mul_multimod: incompatible dimensions\n");
+        abort();
+    }
+
+    m = A->r;
+    l = A->c;
+    n = B->c;
+
+    if (m == 0 || n == 0)
+        return;
+
+    if (l == 0)
+    {
+        renf_mat_zero(C, nf);
+        return;
+    }
+
+    fmpz_poly_init(F);
+    _renf_mat_defining_poly(F, nf);
+    d = fmpz_poly_degree(F);
+
+    anum = _fmpz_vec_init(m * l * d);
+    aden = _fmpz_vec_init(m);
+    bnum = _fmpz_vec_init(l * n * d);
+    bden = _fmpz_vec_init(l);
+    res = _fmpz_vec_init(m * n * d);
+    fmpz_init(M);
+    fmpz_init(ae);
+    fmpz_init(bd);
+    fmpz_init(t);
+
+    _renf_mat_get_fmpz_rows(anum, aden, A, nf);
+    _renf_mat_get_fmpz_rows(bnum, bden, B, nf);
+
+    /* The rows of B need a common denominator so that the entries of the
+     * product have the denominator of the corresponding row of A times bd. */
+    fmpz_one(bd);
+    for (k = 0; k < l; k++)
+        fmpz_lcm(bd, bd, bden + k);
+    for (k = 0; k < l; k++)
+    {
+        fmpz_divexact(t, bd, bden + k);
+        _fmpz_vec_scalar_mul_fmpz(bnum + k * n * d, bnum + k * n * d, n * d, t);
+    }
+
+    /* Each entry of the product of the integer polynomial matrices has
+     * degree at most 2(d - 1) and its coefficients are bounded by the sum of
+     * the products of the 1-norms of the factors. As for the determinant, we
+     * recover lc(F)^e times its remainder modulo F. */
+    e = FLINT_MAX(0, d - 1);
+    bits = max_norm1_bits(anum, m * l, d) + max_norm1_bits(bnum, l * n, d) + FLINT_BIT_COUNT(l);
+    bits = _renf_mat_prem_bits(bits, 2 * (d - 1), F) + 2;
+
+    fmpz_pow_ui(ae, fmpz_poly_lead(F), e);
+
+    fmpz_one(M);
+    p = UWORD(1) << (FLINT_BITS - 2);
+
+    while (fmpz_bits(M) <= bits)
+    {
+        _renf_mat_prime_t P;
+        nmod_poly_t r;
+        ulong * values;
+        ulong ae_p;
+        nmod_mat_struct * amats = NULL;
+        nmod_mat_struct * bmats = NULL;
+        nmod_mat_struct * cmats = NULL;
+        fq_nmod_mat_t amat, bmat, cmat;
+        fq_nmod_t value;
+
+        if (!_renf_mat_prime_init(P, p, F))
+        {
+            _fmpz_vec_clear(anum, m * l * d);
+            _fmpz_vec_clear(aden, m);
+            _fmpz_vec_clear(bnum, l * n * d);
+            _fmpz_vec_clear(bden, l);
+            _fmpz_vec_clear(res, m * n * d);
+            fmpz_clear(M);
+            fmpz_clear(ae);
+            fmpz_clear(bd);
+            fmpz_clear(t);
+            fmpz_poly_clear(F);
+            renf_mat_mul_classical(C, A, B, nf);
+            return;
+        }
+
+        p = P->p;
+        values = (ulong *) flint_malloc(d * sizeof(ulong));
+        nmod_poly_init(r, p);
+        ae_p = fmpz_fdiv_ui(ae, p);
+
+        if (P->split)
+        {
+            amats = (nmod_mat_struct *) flint_malloc(d * sizeof(nmod_mat_struct));
+            bmats = (nmod_mat_struct *) flint_malloc(d * sizeof(nmod_mat_struct));
+            cmats = (nmod_mat_struct *) flint_malloc(d * sizeof(nmod_mat_struct));
+
+            for (k = 0; k < d; k++)
+            {
+                nmod_mat_init(amats + k, m, l, p);
+                nmod_mat_init(bmats + k, l, n, p);
+                nmod_mat_init(cmats + k, m, n, p);
+            }
+
+            _renf_mat_prime_reduce_mat(amats, NULL, anum, m, l, P);
+            _renf_mat_prime_reduce_mat(bmats, NULL, bnum, l, n, P);
+
+            for (k = 0; k < d; k++)
+                nmod_mat_mul(cmats + k, amats + k, bmats + k);
+        }
+        else
+        {
+            fq_nmod_mat_init(amat, m, l, P->ctx);
+            fq_nmod_mat_init(bmat, l, n, P->ctx);
+            fq_nmod_mat_init(cmat, m, n, P->ctx);
+            fq_nmod_init(value, P->ctx);
+
+            _renf_mat_prime_reduce_mat(NULL, amat, anum, m, l, P);
+            _renf_mat_prime_reduce_mat(NULL, bmat, bnum, l, n, P);
+
+            fq_nmod_mat_mul(cmat, amat, bmat, P->ctx);
+        }
+
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                fmpz * entry = res + (i * n + j) * d;
+
+                if (P->split)
+                {
+                    for (k = 0; k < d; k++)
+                        values[k] = nmod_mat_entry(cmats + k, i, j);
+                    _renf_mat_prime_lift(r, values, NULL, P);
+                }
+                else
+                {
+                    _renf_mat_prime_lift(r, NULL, fq_nmod_mat_entry(cmat, i, j), P);
+                }
+
+                for (k = 0; k < d; k++)
+                    fmpz_CRT_ui(entry + k, entry + k, M, n_mulmod2_preinv(nmod_poly_get_coeff_ui(r, k), ae_p, r->mod.n, r->mod.ninv), p, 1);
+            }
+        }
+
+        fmpz_mul_ui(M, M, p);
+
+        if (P->split)
+        {
+            for (k = 0; k < d; k++)
+            {
+                nmod_mat_clear(amats + k);
+                nmod_mat_clear(bmats + k);
+                nmod_mat_clear(cmats + k);
+            }
+            flint_free(amats);
+            flint_free(bmats);
+            flint_free(cmats);
+        }
+        else
+        {
+            fq_nmod_clear(value, P->ctx);
+            fq_nmod_mat_clear(amat, P->ctx);
+            fq_nmod_mat_clear(bmat, P->ctx);
+            fq_nmod_mat_clear(cmat, P->ctx);
+        }
+
+        nmod_poly_clear(r);
+        flint_free(values);
+        _renf_mat_prime_clear(P);
+    }
+
+    fmpq_poly_init(c);
+    fmpq_poly_fit_length(c, d);
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            _fmpz_vec_set(fmpq_poly_numref(c), res + (i * n + j) * d, d);
+            _fmpq_poly_set_length(c, d);
+            fmpz_mul(fmpq_poly_denref(c), ae, aden + i);
+            fmpz_mul(fmpq_poly_denref(c), fmpq_poly_denref(c), bd);
+            fmpq_poly_canonicalise(c);
+
+            nf_elem_set_fmpq_poly(renf_mat_entry(C, i, j)->elem, c, nf->nf);
+        }
+    }
+
+    fmpq_poly_clear(c);
+
+    _renf_mat_set_evaluation(C, nf);
+
+    _fmpz_vec_clear(anum, m * l * d);
+    _fmpz_vec_clear(aden, m);
+    _fmpz_vec_clear(bnum, l * n * d);
+    _fmpz_vec_clear(bden, l);
+    _fmpz_vec_clear(res, m * n * d);
+    fmpz_clear(M);
+    fmpz_clear(ae);
+    fmpz_clear(bd);
+    fmpz_clear(t);
+    fmpz_poly_clear(F);
+}
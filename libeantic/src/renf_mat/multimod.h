@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+/* Shared machinery for the multimodular algorithms of renf_mat.
+ *
+ * Let F be the defining polynomial of the number field made primitive and
+ * integral. After clearing denominators, the entries of a matrix are integer
+ * polynomials of degree less than d = deg(F). We pick word-size primes p
+ * that do not divide the leading coefficient of F and such that F mod p is
+ * squarefree and either splits into linear factors or is irreducible. Then
+ * F_p[x]/(F) is a product of d copies of F_p or the finite field with p^d
+ * elements, and we can work with nmod_mat or fq_nmod_mat there. */
+
+#ifndef E_ANTIC_RENF_MAT_MULTIMOD_H
+#define E_ANTIC_RENF_MAT_MULTIMOD_H
+
+#include <flint/fmpz_poly.h>
+#include <flint/nmod_poly.h>
+#include <flint/nmod_mat.h>
+#include <flint/fq_nmod.h>
+#include <flint/fq_nmod_mat.h>
+
+#include "../../e-antic/renf_mat.h"
+
+typedef struct
+{
+    /* The prime. */
+    ulong p;
+
+    /* The degree of the number field. */
+    slong degree;
+
+    /* F mod p, made monic. */
+    nmod_poly_t F;
+
+    /* Whether F mod p splits into distinct linear factors. */
+    int split;
+
+    /* The d distinct roots of F mod p if split is set. */
+    ulong * roots;
+
+    /* The finite field F_p[x]/(F) if split is not set. */
+    fq_nmod_ctx_t ctx;
+} _renf_mat_prime_struct;
+
+typedef _renf_mat_prime_struct _renf_mat_prime_t[1];
+
+/* Initialize P with the smallest suitable prime larger than p. Returns zero
+ * (and leaves P uninitialized) if no suitable prime has been found after
+ * trying many primes. */
+int _renf_mat_prime_init(_renf_mat_prime_t P, ulong p, const fmpz_poly_t F);
+
+void _renf_mat_prime_clear(_renf_mat_prime_t P);
+
+/* Set F to the primitive integral polynomial defining nf. */
+void _renf_mat_defining_poly(fmpz_poly_t F, const renf_t nf);
+
+/* Write the entries of A as integer polynomials after multiplying each row
+ * with the smallest common denominator of its entries. The coefficients of
+ * the entry (i, j) are stored in num[(i * A->c + j) * d + k] and the
+ * denominator of row i is stored in den[i]. */
+void _renf_mat_get_fmpz_rows(fmpz * num, fmpz * den, const renf_mat_t A, const renf_t nf);
+
+/* Return the number of bits of a bound for the absolute values of the
+ * coefficients of the minors of the r×c matrix of integer polynomials of
+ * length d stored in num as above, i.e., for the coefficients of such a
+ * polynomial minor before reducing it modulo the defining polynomial. */
+slong _renf_mat_hadamard_bits(const fmpz * num, slong r, slong c, slong d);
+
+/* Reduce the r×c matrix of integer polynomials stored in num as above modulo
+ * P. If P is split, the d matrices in mats are set to the values at the
+ * roots of F. Otherwise, mat is set to the image in the finite field. */
+void _renf_mat_prime_reduce_mat(nmod_mat_struct * mats, fq_nmod_mat_t mat, const fmpz * num, slong r, slong c, const _renf_mat_prime_t P);
+
+/* Reduce the integer polynomial of length d stored in num modulo P and write
+ * its image in the components of F_p[x]/(F), i.e., the values at the roots
+ * of F if P is split. */
+void _renf_mat_prime_reduce(ulong * values, fq_nmod_t value, const fmpz * num, nmod_poly_t tmp, const _renf_mat_prime_t P);
+
+/* Set res to the polynomial of degree less than d determined by its image in
+ * the components of F_p[x]/(F), i.e., the inverse of _renf_mat_prime_reduce. */
+void _renf_mat_prime_lift(nmod_poly_t res, const ulong * values, const fq_nmod_t value, const _renf_mat_prime_t P);
+
+/* Return the number of bits of an upper bound for the absolute values of the
+ * coefficients of the pseudo-remainder of an integer polynomial of degree
+ * at most deg whose coefficients are bounded by 2^bits by F, i.e., of
+ * lc(F)^e P mod F with e = max(0, deg - d + 1). */
+slong _renf_mat_prem_bits(slong bits, slong deg, const fmpz_poly_t F);
+
+#endif
@@ -0,0 +1,20 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+void _renf_mat_defining_poly(fmpz_poly_t F, const renf_t nf)
+{
+    fmpq_poly_get_numerator(F, nf->nf->pol);
+    fmpz_poly_primitive_part(F, F);
+}
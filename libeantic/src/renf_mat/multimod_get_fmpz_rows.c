@@ -0,0 +1,50 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+void _renf_mat_get_fmpz_rows(fmpz * num, fmpz * den, const renf_mat_t A, const renf_t nf)
+{
+    slong i, j;
+    const slong d = fmpq_poly_degree(nf->nf->pol);
+    fmpz_t t;
+    fmpq_poly_t e;
+
+    fmpz_init(t);
+    fmpq_poly_init(e);
+
+    for (i = 0; i < A->r; i++)
+    {
+        fmpz_one(den + i);
+
+        for (j = 0; j < A->c; j++)
+        {
+            nf_elem_get_fmpq_poly(e, renf_mat_entry(A, i, j)->elem, nf->nf);
+            fmpz_lcm(den + i, den + i, fmpq_poly_denref(e));
+        }
+
+        for (j = 0; j < A->c; j++)
+        {
+            fmpz * entry = num + (i * A->c + j) * d;
+
+            nf_elem_get_fmpq_poly(e, renf_mat_entry(A, i, j)->elem, nf->nf);
+            fmpz_divexact(t, den + i, fmpq_poly_denref(e));
+
+            _fmpz_vec_scalar_mul_fmpz(entry, fmpq_poly_numref(e), fmpq_poly_length(e), t);
+            _fmpz_vec_zero(entry + fmpq_poly_length(e), d - fmpq_poly_length(e));
+        }
+    }
+
+    fmpz_clear(t);
+    fmpq_poly_clear(e);
+}
@@ -0,0 +1,61 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+slong _renf_mat_hadamard_bits(const fmpz * num, slong r, slong c, slong d)
+{
+    slong i, j, k, bits;
+    fmpz_t H, s, t;
+
+    fmpz_init(H);
+    fmpz_init(s);
+    fmpz_init(t);
+
+    /* On the unit circle, the absolute value of an entry is bounded by the
+     * 1-norm of its coefficients. Hadamard's inequality then bounds the
+     * absolute value of a minor on the unit circle and thereby the absolute
+     * values of its coefficients. Since the squared norms of nonzero rows are
+     * integers, the product over all rows also bounds the smaller minors. */
+    fmpz_one(H);
+
+    for (i = 0; i < r; i++)
+    {
+        fmpz_zero(s);
+
+        for (j = 0; j < c; j++)
+        {
+            fmpz_zero(t);
+            for (k = 0; k < d; k++)
+            {
+                const fmpz * a = num + (i * c + j) * d + k;
+                if (fmpz_sgn(a) >= 0)
+                    fmpz_add(t, t, a);
+                else
+                    fmpz_sub(t, t, a);
+            }
+            fmpz_addmul(s, t, t);
+        }
+
+        if (!fmpz_is_zero(s))
+            fmpz_mul(H, H, s);
+    }
+
+    bits = (fmpz_bits(H) + 1) / 2;
+
+    fmpz_clear(H);
+    fmpz_clear(s);
+    fmpz_clear(t);
+
+    return bits;
+}
@@ -0,0 +1,22 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+void _renf_mat_prime_lift(nmod_poly_t res, const ulong * values, const fq_nmod_t value, const _renf_mat_prime_t P)
+{
+    if (P->split)
+        nmod_poly_interpolate_nmod_vec(res, P->roots, values, P->degree);
+    else
+        fq_nmod_get_nmod_poly(res, value, P->ctx);
+}
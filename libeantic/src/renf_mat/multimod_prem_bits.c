@@ -0,0 +1,38 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+slong _renf_mat_prem_bits(slong bits, slong deg, const fmpz_poly_t F)
+{
+    slong e;
+    fmpz_t t;
+
+    e = FLINT_MAX(0, deg - fmpz_poly_degree(F) + 1);
+
+    /* Every step of the pseudo-division replaces r with lc(F) r - c x^k F
+     * where c is the leading coefficient of r, so the coefficients grow at
+     * most by a factor |lc(F)| + |F|_oo in each of the e steps. */
+    fmpz_init(t);
+    fmpz_poly_height(t, F);
+    if (fmpz_sgn(fmpz_poly_lead(F)) > 0)
+        fmpz_add(t, t, fmpz_poly_lead(F));
+    else
+        fmpz_sub(t, t, fmpz_poly_lead(F));
+
+    bits += e * fmpz_bits(t);
+
+    fmpz_clear(t);
+
+    return bits;
+}
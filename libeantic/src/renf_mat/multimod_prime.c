@@ -0,0 +1,76 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+/* The number of consecutive primes we try before giving up. For typical
+ * fields a suitable prime shows up after a handful of attempts. The density
+ * of primes at which F is irreducible is at least 1/d if the Galois group
+ * contains a d-cycle and the density of primes at which F splits completely
+ * is always 1/|G| by Chebotarev. */
+#define RENF_MAT_PRIME_ATTEMPTS 4096
+
+int _renf_mat_prime_init(_renf_mat_prime_t P, ulong p, const fmpz_poly_t F)
+{
+    slong i, attempt;
+    const slong d = fmpz_poly_degree(F);
+    nmod_poly_factor_t fac;
+
+    P->degree = d;
+    P->roots = (ulong *) flint_malloc(FLINT_MAX(d, 1) * sizeof(ulong));
+
+    for (attempt = 0; attempt < RENF_MAT_PRIME_ATTEMPTS; attempt++)
+    {
+        p = n_nextprime(p, 1);
+
+        if (fmpz_fdiv_ui(fmpz_poly_lead(F), p) == 0)
+            continue;
+
+        nmod_poly_init(P->F, p);
+        fmpz_poly_get_nmod_poly(P->F, F);
+        nmod_poly_make_monic(P->F, P->F);
+
+        nmod_poly_factor_init(fac);
+        nmod_poly_factor(fac, P->F);
+
+        P->p = p;
+        P->split = fac->num == d;
+
+        for (i = 0; i < fac->num; i++)
+        {
+            if (fac->exp[i] != 1 || nmod_poly_degree(fac->p + i) != 1)
+                P->split = 0;
+            else
+                P->roots[i] = nmod_neg(nmod_poly_get_coeff_ui(fac->p + i, 0), P->F->mod);
+        }
+
+        if (P->split)
+        {
+            nmod_poly_factor_clear(fac);
+            return 1;
+        }
+
+        if (fac->num == 1 && fac->exp[0] == 1)
+        {
+            nmod_poly_factor_clear(fac);
+            fq_nmod_ctx_init_modulus(P->ctx, P->F, "x");
+            return 1;
+        }
+
+        nmod_poly_factor_clear(fac);
+        nmod_poly_clear(P->F);
+    }
+
+    flint_free(P->roots);
+    return 0;
+}
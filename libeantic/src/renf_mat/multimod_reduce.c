@@ -0,0 +1,33 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+void _renf_mat_prime_reduce(ulong * values, fq_nmod_t value, const fmpz * num, nmod_poly_t tmp, const _renf_mat_prime_t P)
+{
+    slong k;
+
+    nmod_poly_zero(tmp);
+    for (k = P->degree - 1; k >= 0; k--)
+        nmod_poly_set_coeff_ui(tmp, k, fmpz_fdiv_ui(num + k, P->p));
+
+    if (P->split)
+    {
+        for (k = 0; k < P->degree; k++)
+            values[k] = nmod_poly_evaluate_nmod(tmp, P->roots[k]);
+    }
+    else
+    {
+        fq_nmod_set_nmod_poly(value, tmp, P->ctx);
+    }
+}
@@ -0,0 +1,46 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+void _renf_mat_prime_reduce_mat(nmod_mat_struct * mats, fq_nmod_mat_t mat, const fmpz * num, slong r, slong c, const _renf_mat_prime_t P)
+{
+    slong i, j, k;
+    ulong * values;
+    nmod_poly_t tmp;
+
+    values = (ulong *) flint_malloc(FLINT_MAX(P->degree, 1) * sizeof(ulong));
+    nmod_poly_init(tmp, P->p);
+
+    for (i = 0; i < r; i++)
+    {
+        for (j = 0; j < c; j++)
+        {
+            const fmpz * entry = num + (i * c + j) * P->degree;
+
+            if (P->split)
+            {
+                _renf_mat_prime_reduce(values, NULL, entry, tmp, P);
+                for (k = 0; k < P->degree; k++)
+                    nmod_mat_entry(mats + k, i, j) = values[k];
+            }
+            else
+            {
+                _renf_mat_prime_reduce(NULL, fq_nmod_mat_entry(mat, i, j), entry, tmp, P);
+            }
+        }
+    }
+
+    nmod_poly_clear(tmp);
+    flint_free(values);
+}
@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+slong renf_mat_nullspace(renf_mat_t X, const renf_mat_t A, renf_t nf)
+{
+    slong i, j, k, n, rank, nullity;
+    slong * pivots;
+    slong * nonpivots;
+    renf_mat_t R;
+
+    n = A->c;
+
+    if (X->r != n || X->c != n)
+    {
+        fprintf(stderr, "renf_mat_nullspace: incompatible dimensions\n");
+        abort();
+    }
+
+    renf_mat_init(R, A->r, n, nf);
+    rank = renf_mat_rref(R, A, nf);
+    nullity = n - rank;
+
+    pivots = (slong *) flint_malloc(FLINT_MAX(n, 1) * sizeof(slong));
+    nonpivots = pivots + rank;
+
+    for (i = 0, j = 0, k = 0; j < n; j++)
+    {
+        if (i < rank && !nf_elem_is_zero(renf_mat_entry(R, i, j)->elem, nf->nf))
+            pivots[i++] = j;
+        else
+            nonpivots[k++] = j;
+    }
+
+    renf_mat_zero(X, nf);
+
+    /* Each free variable gives rise to one basis vector of the kernel: set
+     * it to one, all other free variables to zero, and solve for the pivot
+     * variables. */
+    for (k = 0; k < nullity; k++)
+    {
+        renf_elem_one(renf_mat_entry(X, nonpivots[k], k), nf);
+
+        for (i = 0; i < rank; i++)
+            renf_elem_neg(renf_mat_entry(X, pivots[i], k), renf_mat_entry(R, i, nonpivots[k]), nf);
+    }
+
+    flint_free(pivots);
+    renf_mat_clear(R, nf);
+
+    return nullity;
+}
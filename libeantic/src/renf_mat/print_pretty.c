@@ -0,0 +1,31 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+void renf_mat_print_pretty(const renf_mat_t mat, const char * var, renf_t nf, slong n, int flag)
+{
+    slong i, j;
+
+    for (i = 0; i < mat->r; i++)
+    {
+        printf("[");
+        for (j = 0; j < mat->c; j++)
+        {
+            if (j)
+                printf(", ");
+            renf_elem_print_pretty(renf_mat_entry(mat, i, j), var, nf, n, flag);
+        }
+        printf("]\n");
+    }
+}
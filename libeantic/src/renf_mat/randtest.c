@@ -0,0 +1,23 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+void renf_mat_randtest(renf_mat_t mat, flint_rand_t state, mp_bitcnt_t bits, renf_t nf)
+{
+    slong i, j;
+
+    for (i = 0; i < mat->r; i++)
+        for (j = 0; j < mat->c; j++)
+            renf_elem_randtest(renf_mat_entry(mat, i, j), state, bits, nf);
+}
@@ -0,0 +1,24 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+#define RENF_MAT_RANK_MULTIMOD_CUTOFF 8
+
+slong renf_mat_rank(const renf_mat_t A, renf_t nf)
+{
+    if (fmpq_poly_degree(nf->nf->pol) > 1 && FLINT_MIN(A->r, A->c) >= RENF_MAT_RANK_MULTIMOD_CUTOFF)
+        return renf_mat_rank_multimod(A, nf);
+    else
+        return renf_mat_rank_fflu(A, nf);
+}
@@ -0,0 +1,34 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+slong renf_mat_rank_fflu(const renf_mat_t A, renf_t nf)
+{
+    slong rank;
+    renf_mat_t B;
+    renf_elem_t den;
+
+    if (A->r == 0 || A->c == 0)
+        return 0;
+
+    renf_mat_init(B, A->r, A->c, nf);
+    renf_elem_init(den, nf);
+
+    rank = renf_mat_fflu(B, den, NULL, A, 0, nf);
+
+    renf_elem_clear(den, nf);
+    renf_mat_clear(B, nf);
+
+    return rank;
+}
@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "multimod.h"
+
+slong renf_mat_rank_multimod(const renf_mat_t A, renf_t nf)
+{
+    slong k, m, n, d, r, rank, bits;
+    fmpz * num;
+    fmpz * den;
+    fmpz_t M;
+    fmpz_poly_t F;
+    ulong p;
+
+    m = A->r;
+    n = A->c;
+    r = FLINT_MIN(m, n);
+
+    if (r == 0)
+        return 0;
+
+    fmpz_poly_init(F);
+    _renf_mat_defining_poly(F, nf);
+    d = fmpz_poly_degree(F);
+
+    num = _fmpz_vec_init(m * n * d);
+    den = _fmpz_vec_init(m);
+    fmpz_init(M);
+
+    _renf_mat_get_fmpz_rows(num, den, A, nf);
+
+    /* The rank modulo a prime never exceeds the actual rank. It is smaller
+     * only if the prime divides all coefficients of lc(F)^e (D mod F) for
+     * every nonzero maximal minor D. So once the product of the primes
+     * exceeds the bound on these coefficients, the largest rank we have seen
+     * is the actual rank. */
+    bits = _renf_mat_prem_bits(_renf_mat_hadamard_bits(num, m, n, d), r * (d - 1), F) + 1;
+
+    rank = 0;
+    fmpz_one(M);
+    p = UWORD(1) << (FLINT_BITS - 2);
+
+    while (rank < r && fmpz_bits(M) <= bits)
+    {
+        _renf_mat_prime_t P;
+
+        if (!_renf_mat_prime_init(P, p, F))
+        {
+            rank = renf_mat_rank_fflu(A, nf);
+            break;
+        }
+
+        p = P->p;
+
+        if (P->split)
+        {
+            nmod_mat_struct * mats = (nmod_mat_struct *) flint_malloc(d * sizeof(nmod_mat_struct));
+
+            for (k = 0; k < d; k++)
+                nmod_mat_init(mats + k, m, n, p);
+
+            _renf_mat_prime_reduce_mat(mats, NULL, num, m, n, P);
+
+            for (k = 0; k < d; k++)
+            {
+                rank = FLINT_MAX(rank, nmod_mat_rank(mats + k));
+                nmod_mat_clear(mats + k);
+            }
+
+            flint_free(mats);
+        }
+        else
+        {
+            fq_nmod_mat_t mat;
+
+            fq_nmod_mat_init(mat, m, n, P->ctx);
+            _renf_mat_prime_reduce_mat(NULL, mat, num, m, n, P);
+            rank = FLINT_MAX(rank, fq_nmod_mat_rank(mat, P->ctx));
+            fq_nmod_mat_clear(mat, P->ctx);
+        }
+
+        fmpz_mul_ui(M, M, p);
+
+        _renf_mat_prime_clear(P);
+    }
+
+    _fmpz_vec_clear(num, m * n * d);
+    _fmpz_vec_clear(den, m);
+    fmpz_clear(M);
+    fmpz_poly_clear(F);
+
+    return rank;
+}
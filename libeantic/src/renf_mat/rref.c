@@ -0,0 +1,75 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+slong renf_mat_rref(renf_mat_t B, const renf_mat_t A, renf_t nf)
+{
+    slong m, n, r, c, i, j;
+    nf_elem_t t, f;
+
+    renf_mat_set(B, A, nf);
+
+    m = B->r;
+    n = B->c;
+
+    nf_elem_init(t, nf->nf);
+    nf_elem_init(f, nf->nf);
+
+    for (r = 0, c = 0; r < m && c < n; c++)
+    {
+        for (i = r; i < m; i++)
+            if (!nf_elem_is_zero(renf_mat_entry(B, i, c)->elem, nf->nf))
+                break;
+
+        if (i == m)
+            continue;
+
+        renf_mat_swap_rows(B, NULL, r, i);
+
+        /* Normalize the pivot row. This is the only inversion for this
+         * pivot; all other operations are multiplications. */
+        nf_elem_inv(f, renf_mat_entry(B, r, c)->elem, nf->nf);
+        nf_elem_one(renf_mat_entry(B, r, c)->elem, nf->nf);
+        for (j = c + 1; j < n; j++)
+            if (!nf_elem_is_zero(renf_mat_entry(B, r, j)->elem, nf->nf))
+                nf_elem_mul(renf_mat_entry(B, r, j)->elem, renf_mat_entry(B, r, j)->elem, f, nf->nf);
+
+        for (i = 0; i < m; i++)
+        {
+            if (i == r || nf_elem_is_zero(renf_mat_entry(B, i, c)->elem, nf->nf))
+                continue;
+
+            nf_elem_swap(f, renf_mat_entry(B, i, c)->elem, nf->nf);
+            nf_elem_zero(renf_mat_entry(B, i, c)->elem, nf->nf);
+
+            for (j = c + 1; j < n; j++)
+            {
+                if (nf_elem_is_zero(renf_mat_entry(B, r, j)->elem, nf->nf))
+                    continue;
+
+                nf_elem_mul(t, f, renf_mat_entry(B, r, j)->elem, nf->nf);
+                nf_elem_sub(renf_mat_entry(B, i, j)->elem, renf_mat_entry(B, i, j)->elem, t, nf->nf);
+            }
+        }
+
+        r++;
+    }
+
+    nf_elem_clear(t, nf->nf);
+    nf_elem_clear(f, nf->nf);
+
+    _renf_mat_set_evaluation(B, nf);
+
+    return r;
+}
@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+void renf_mat_set(renf_mat_t mat1, const renf_mat_t mat2, const renf_t nf)
+{
+    slong i, j;
+
+    if (mat1 == mat2)
+        return;
+
+    if (mat1->r != mat2->r || mat1->c != mat2->c)
+    {
+        fprintf(stderr, "renf_mat_set: incompatible dimensions\n");
+        abort();
+    }
+
+    for (i = 0; i < mat2->r; i++)
+        for (j = 0; j < mat2->c; j++)
+            renf_elem_set(renf_mat_entry(mat1, i, j), renf_mat_entry(mat2, i, j), nf);
+}
@@ -0,0 +1,65 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+int renf_mat_solve(renf_mat_t X, const renf_mat_t A, const renf_mat_t B, renf_t nf)
+{
+    slong i, j, k, rank;
+    int solvable = 1;
+    renf_mat_t M;
+
+    if (A->r != B->r || X->r != A->c || X->c != B->c)
+    {
+        fprintf(stderr, "renf_mat_solve: incompatible dimensions\n");
+        abort();
+    }
+
+    /* Bring [A | B] into reduced row echelon form. The system is solvable
+     * iff no pivot is in the columns of B. */
+    renf_mat_init(M, A->r, A->c + B->c, nf);
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < A->c; j++)
+            renf_elem_set(renf_mat_entry(M, i, j), renf_mat_entry(A, i, j), nf);
+        for (j = 0; j < B->c; j++)
+            renf_elem_set(renf_mat_entry(M, i, A->c + j), renf_mat_entry(B, i, j), nf);
+    }
+
+    rank = renf_mat_rref(M, M, nf);
+
+    renf_mat_zero(X, nf);
+
+    for (i = 0, j = 0; i < rank; i++)
+    {
+        /* Find the pivot column of row i. */
+        while (nf_elem_is_zero(renf_mat_entry(M, i, j)->elem, nf->nf))
+            j++;
+
+        if (j >= A->c)
+        {
+            solvable = 0;
+            break;
+        }
+
+        /* Free variables are set to zero so the pivot variable is determined
+         * by the right hand side. */
+        for (k = 0; k < B->c; k++)
+            renf_elem_set(renf_mat_entry(X, j, k), renf_mat_entry(M, i, A->c + k), nf);
+    }
+
+    renf_mat_clear(M, nf);
+
+    return solvable;
+}
@@ -0,0 +1,22 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+void renf_mat_zero(renf_mat_t mat, const renf_t nf)
+{
+    slong i;
+
+    for (i = 0; i < mat->r * mat->c; i++)
+        renf_elem_zero(mat->entries + i, nf);
+}
@@ -0,0 +1,24 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <float.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+int _renf_soa_certainly_lt(const renf_soa_t v, slong i, slong j)
+{
+    /* The difference mid_j - mid_i and the sum of radii are rounded to
+     * nearest. We enlarge the sum so that the comparison remains conclusive
+     * in the presence of these rounding errors (and of underflow.) */
+    return v->mid[j] - v->mid[i] > ((v->rad[i] + v->rad[j]) + DBL_MIN) * (1 + 4 * DBL_EPSILON);
+}
@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+void renf_soa_clear(renf_soa_t v)
+{
+    slong i;
+
+    for (i = 0; i < v->alloc * v->degree; i++)
+        fmpz_clear(v->num + i);
+    for (i = 0; i < v->alloc; i++)
+        fmpz_clear(v->den + i);
+
+    flint_free(v->num);
+    flint_free(v->den);
+    flint_free(v->mid);
+    flint_free(v->rad);
+}
@@ -0,0 +1,45 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+int renf_soa_cmp(renf_soa_t v, slong i, slong j, renf_t nf)
+{
+    int res;
+    renf_elem_t a, b;
+
+    if (i == j)
+        return 0;
+    if (_renf_soa_certainly_lt(v, i, j))
+        return -1;
+    if (_renf_soa_certainly_lt(v, j, i))
+        return 1;
+
+    renf_elem_init(a, nf);
+    renf_elem_init(b, nf);
+
+    renf_soa_get_entry(a, v, i, nf);
+    renf_soa_get_entry(b, v, j, nf);
+
+    res = renf_elem_cmp(a, b, nf);
+
+    /* Comparison might have refined the embeddings. We keep these better
+     * enclosures so that later comparisons can be decided faster. */
+    _renf_soa_set_enclosure_arb(v, i, a->emb);
+    _renf_soa_set_enclosure_arb(v, j, b->emb);
+
+    renf_elem_clear(a, nf);
+    renf_elem_clear(b, nf);
+
+    return res;
+}
@@ -0,0 +1,124 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <float.h>
+#include <math.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+/* The number of elements that are evaluated simultaneously. The coefficients
+ * of a block are transposed so that the Horner steps below run over
+ * contiguous memory and can be vectorized by the compiler. */
+#define RENF_SOA_BLOCK 128
+
+/* The unit roundoff of double precision. */
+#define U (DBL_EPSILON / 2)
+
+/* On x86-64 with GCC we compile the kernel for several instruction sets and
+ * let the dynamic loader pick the best one for the CPU we are running on. */
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__ELF__)
+#define RENF_SOA_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define RENF_SOA_TARGET_CLONES
+#endif
+
+/* Evaluate the len polynomials whose coefficients are stored in c, i.e., the
+ * coefficient of degree k of the j-th polynomial is c[k * RENF_SOA_BLOCK + j],
+ * at the ball [xm - xr, xm + xr] and divide by the denominators den.
+ *
+ * Every operation is performed in round-to-nearest so we account for the
+ * rounding error u|y| + DBL_MIN of each operation with result y in the radii.
+ * The radii are themselves rounded to nearest which we compensate for by
+ * scaling them with 1 + 16u in every step. (The bounds are also valid if the
+ * compiler contracts a product and a sum into a fused multiply-add.) */
+RENF_SOA_TARGET_CLONES
+static void _renf_soa_evaluate_d_block(double * mid, double * rad, const double * c, const double * den, slong len, slong degree, double xm, double xr)
+{
+    slong j, k;
+    const double axm = fabs(xm) + xr;
+
+    for (j = 0; j < len; j++)
+    {
+        mid[j] = c[(degree - 1) * RENF_SOA_BLOCK + j];
+        rad[j] = fabs(mid[j]) * DBL_EPSILON;
+    }
+
+    for (k = degree - 2; k >= 0; k--)
+    {
+        const double * ck = c + k * RENF_SOA_BLOCK;
+
+        for (j = 0; j < len; j++)
+        {
+            const double p = mid[j] * xm;
+            const double s = p + ck[j];
+
+            rad[j] = (fabs(mid[j]) * xr + rad[j] * axm + (fabs(p) + fabs(s)) * U + fabs(ck[j]) * DBL_EPSILON + DBL_MIN) * (1 + 16 * U);
+            mid[j] = s;
+        }
+    }
+
+    for (j = 0; j < len; j++)
+    {
+        const double q = mid[j] / den[j];
+
+        rad[j] = (rad[j] / den[j] + fabs(q) * (U + DBL_EPSILON) + DBL_MIN) * (1 + 16 * U);
+        mid[j] = q;
+    }
+}
+
+/* Return x rounded towards zero or NaN if x is so large that its conversion
+ * would overflow. */
+static double _renf_soa_fmpz_get_d(const fmpz_t x)
+{
+    if (fmpz_bits(x) > DBL_MAX_EXP - 1)
+        return NAN;
+    return fmpz_get_d(x);
+}
+
+void _renf_soa_evaluate_d(double * mid, double * rad, const fmpz * num, const fmpz * den, slong len, slong degree, double xm, double xr)
+{
+    slong i, j, k, n;
+    double * c;
+    double * d;
+
+    c = (double *) flint_malloc((degree * RENF_SOA_BLOCK + RENF_SOA_BLOCK) * sizeof(double));
+    d = c + degree * RENF_SOA_BLOCK;
+
+    for (i = 0; i < len; i += RENF_SOA_BLOCK)
+    {
+        n = FLINT_MIN(RENF_SOA_BLOCK, len - i);
+
+        /* Conversion from fmpz rounds towards zero, so the conversion error
+         * of each coefficient is at most DBL_EPSILON times its approximation.
+         * This is accounted for in the kernel. */
+        for (j = 0; j < n; j++)
+        {
+            for (k = 0; k < degree; k++)
+                c[k * RENF_SOA_BLOCK + j] = _renf_soa_fmpz_get_d(num + (i + j) * degree + k);
+            d[j] = _renf_soa_fmpz_get_d(den + i + j);
+        }
+
+        _renf_soa_evaluate_d_block(mid + i, rad + i, c, d, n, degree, xm, xr);
+
+        for (j = i; j < i + n; j++)
+        {
+            if (!isfinite(mid[j]) || !isfinite(rad[j]))
+            {
+                mid[j] = 0;
+                rad[j] = INFINITY;
+            }
+        }
+    }
+
+    flint_free(c);
+}
@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+void renf_soa_fit_length(renf_soa_t v, slong len)
+{
+    slong i, alloc;
+
+    if (len <= v->alloc)
+        return;
+
+    alloc = FLINT_MAX(len, 2 * v->alloc);
+
+    v->num = (fmpz *) flint_realloc(v->num, alloc * v->degree * sizeof(fmpz));
+    v->den = (fmpz *) flint_realloc(v->den, alloc * sizeof(fmpz));
+    v->mid = (double *) flint_realloc(v->mid, alloc * sizeof(double));
+    v->rad = (double *) flint_realloc(v->rad, alloc * sizeof(double));
+
+    for (i = v->alloc * v->degree; i < alloc * v->degree; i++)
+        fmpz_init(v->num + i);
+    for (i = v->alloc; i < alloc; i++)
+        fmpz_init_set_ui(v->den + i, 1);
+
+    v->alloc = alloc;
+}
@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+void renf_soa_get_entry(renf_elem_t a, const renf_soa_t v, slong i, renf_t nf)
+{
+    if (i < 0 || i >= v->length)
+    {
+        fprintf(stderr, "renf_soa_get_entry: index out of range\n");
+        abort();
+    }
+
+    _renf_soa_get_nf_elem(a->elem, v, i, nf);
+    renf_elem_set_evaluation(a, nf, nf->prec);
+}
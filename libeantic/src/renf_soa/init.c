@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+void renf_soa_init(renf_soa_t v, const renf_t nf)
+{
+    v->length = 0;
+    v->alloc = 0;
+    v->degree = fmpq_poly_degree(nf->nf->pol);
+    v->num = NULL;
+    v->den = NULL;
+    v->mid = NULL;
+    v->rad = NULL;
+}
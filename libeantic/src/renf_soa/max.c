@@ -0,0 +1,39 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+slong renf_soa_max(renf_soa_t v, renf_t nf)
+{
+    slong i, best;
+
+    if (v->length == 0)
+        return -1;
+
+    /* Start from the element with the largest upper bound, see renf_soa_min. */
+    best = 0;
+    for (i = 1; i < v->length; i++)
+        if (v->mid[i] + v->rad[i] > v->mid[best] + v->rad[best])
+            best = i;
+
+    for (i = 0; i < v->length; i++)
+    {
+        if (i == best || _renf_soa_certainly_lt(v, i, best))
+            continue;
+
+        if (renf_soa_cmp(v, i, best, nf) > 0)
+            best = i;
+    }
+
+    return best;
+}
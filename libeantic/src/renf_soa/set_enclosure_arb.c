@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+void _renf_soa_enclosure_arb(double * m, double * r, const arb_t x)
+{
+    arf_t t;
+    double lo, hi, mid, rad;
+
+    arf_init(t);
+
+    arb_get_lbound_arf(t, x, 53);
+    lo = arf_get_d(t, ARF_RND_FLOOR);
+
+    arb_get_ubound_arf(t, x, 53);
+    hi = arf_get_d(t, ARF_RND_CEIL);
+
+    arf_clear(t);
+
+    if (!isfinite(lo) || !isfinite(hi))
+    {
+        *m = 0;
+        *r = INFINITY;
+        return;
+    }
+
+    /* The midpoint is not exact in general. We bound the distance to both
+     * endpoints and round the radius up once more to account for the error in
+     * computing that distance. */
+    mid = lo + (hi - lo) / 2;
+    rad = FLINT_MAX(hi - mid, mid - lo);
+
+    *m = mid;
+    *r = nextafter(rad, INFINITY);
+}
+
+void _renf_soa_set_enclosure_arb(renf_soa_t v, slong i, const arb_t x)
+{
+    _renf_soa_enclosure_arb(v->mid + i, v->rad + i, x);
+}
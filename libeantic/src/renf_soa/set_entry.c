@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+void renf_soa_set_entry(renf_soa_t v, slong i, const renf_elem_t a, const renf_t nf)
+{
+    if (i < 0 || i >= v->length)
+    {
+        fprintf(stderr, "renf_soa_set_entry: index out of range\n");
+        abort();
+    }
+
+    _renf_soa_set_nf_elem(v, i, a->elem, nf);
+    _renf_soa_set_enclosure_arb(v, i, a->emb);
+}
@@ -0,0 +1,43 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+void renf_soa_set_evaluation(renf_soa_t v, renf_t nf)
+{
+    slong i;
+    double xm, xr;
+    double * mid;
+    double * rad;
+
+    if (v->length == 0)
+        return;
+
+    mid = (double *) flint_malloc(2 * v->length * sizeof(double));
+    rad = mid + v->length;
+
+    _renf_soa_enclosure_arb(&xm, &xr, nf->emb);
+    _renf_soa_evaluate_d(mid, rad, v->num, v->den, v->length, v->degree, xm, xr);
+
+    /* Both enclosures are correct, we keep whichever is tighter. */
+    for (i = 0; i < v->length; i++)
+    {
+        if (rad[i] < v->rad[i])
+        {
+            v->mid[i] = mid[i];
+            v->rad[i] = rad[i];
+        }
+    }
+
+    flint_free(mid);
+}
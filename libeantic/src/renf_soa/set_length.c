@@ -0,0 +1,38 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+void renf_soa_set_length(renf_soa_t v, slong len)
+{
+    slong i;
+
+    renf_soa_fit_length(v, len);
+
+    for (i = len; i < v->length; i++)
+    {
+        /* Release the memory of the truncated elements. Not only is it not
+         * needed anymore but renf_soa_fit_length expects unused entries to be
+         * zero. */
+        _fmpz_vec_zero(v->num + i * v->degree, v->degree);
+        fmpz_one(v->den + i);
+    }
+
+    for (i = v->length; i < len; i++)
+    {
+        v->mid[i] = 0;
+        v->rad[i] = 0;
+    }
+
+    v->length = len;
+}
@@ -0,0 +1,38 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+void _renf_soa_set_nf_elem(renf_soa_t v, slong i, const nf_elem_t a, const renf_t nf)
+{
+    fmpz * num = v->num + i * v->degree;
+
+    if (nf->nf->flag & NF_LINEAR)
+    {
+        fmpz_set(num, LNF_ELEM_NUMREF(a));
+        fmpz_set(v->den + i, LNF_ELEM_DENREF(a));
+    }
+    else if (nf->nf->flag & NF_QUADRATIC)
+    {
+        _fmpz_vec_set(num, QNF_ELEM_NUMREF(a), 2);
+        fmpz_set(v->den + i, QNF_ELEM_DENREF(a));
+    }
+    else
+    {
+        const slong len = NF_ELEM(a)->length;
+
+        _fmpz_vec_set(num, NF_ELEM_NUMREF(a), len);
+        _fmpz_vec_zero(num + len, v->degree - len);
+        fmpz_set(v->den + i, NF_ELEM_DENREF(a));
+    }
+}
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+void renf_soa_sgn(int * res, renf_soa_t v, renf_t nf)
+{
+    slong i;
+    renf_elem_t a;
+    int initialized = 0;
+
+    for (i = 0; i < v->length; i++)
+    {
+        if (v->mid[i] > v->rad[i])
+            res[i] = 1;
+        else if (-v->mid[i] > v->rad[i])
+            res[i] = -1;
+        else
+        {
+            if (!initialized)
+            {
+                renf_elem_init(a, nf);
+                initialized = 1;
+            }
+
+            renf_soa_get_entry(a, v, i, nf);
+            res[i] = renf_elem_sgn(a, nf);
+            _renf_soa_set_enclosure_arb(v, i, a->emb);
+        }
+    }
+
+    if (initialized)
+        renf_elem_clear(a, nf);
+}
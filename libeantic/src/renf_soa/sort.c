@@ -0,0 +1,81 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+typedef struct
+{
+    double mid;
+    slong index;
+} renf_soa_sort_entry;
+
+static int renf_soa_sort_entry_cmp(const void * lhs, const void * rhs)
+{
+    const renf_soa_sort_entry * a = (const renf_soa_sort_entry *) lhs;
+    const renf_soa_sort_entry * b = (const renf_soa_sort_entry *) rhs;
+
+    if (a->mid < b->mid)
+        return -1;
+    if (a->mid > b->mid)
+        return 1;
+    return (a->index > b->index) - (a->index < b->index);
+}
+
+/* Return whether the element at position i of v must come after the
+ * element at position j in the sorted order. */
+static int renf_soa_sort_after(renf_soa_t v, slong i, slong j, renf_t nf)
+{
+    int c = renf_soa_cmp(v, i, j, nf);
+    return c > 0 || (c == 0 && i > j);
+}
+
+void renf_soa_sort(slong * perm, renf_soa_t v, renf_t nf)
+{
+    slong i, j;
+    renf_soa_sort_entry * entries;
+
+    if (v->length == 0)
+        return;
+
+    /* Sort by the midpoints of the enclosures first. Apart from elements
+     * whose enclosures overlap, this already yields the correct order. */
+    entries = (renf_soa_sort_entry *) flint_malloc(v->length * sizeof(renf_soa_sort_entry));
+
+    for (i = 0; i < v->length; i++)
+    {
+        entries[i].mid = v->mid[i];
+        entries[i].index = i;
+    }
+
+    qsort(entries, v->length, sizeof(renf_soa_sort_entry), renf_soa_sort_entry_cmp);
+
+    for (i = 0; i < v->length; i++)
+        perm[i] = entries[i].index;
+
+    flint_free(entries);
+
+    /* Fix the remaining inversions with an insertion sort. Neighbours with
+     * disjoint enclosures are compared without consulting the exact
+     * coefficients so this is linear unless many enclosures overlap. */
+    for (i = 1; i < v->length; i++)
+    {
+        const slong p = perm[i];
+
+        for (j = i; j > 0 && renf_soa_sort_after(v, perm[j - 1], p, nf); j--)
+            perm[j] = perm[j - 1];
+
+        perm[j] = p;
+    }
+}
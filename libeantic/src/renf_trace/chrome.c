@@ -0,0 +1,107 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_trace.h"
+
+/* The state of the Chrome trace backend. Events are written as complete
+ * events ("ph": "X") of the JSON Array Format. The closing bracket is
+ * optional in that format so a trace of a process that never calls
+ * renf_trace_chrome_close() can still be loaded. */
+static FILE * renf_trace_chrome_file = NULL;
+static ulong renf_trace_chrome_origin = 0;
+static int renf_trace_chrome_empty = 1;
+static pthread_mutex_t renf_trace_chrome_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Return an identifier of the calling thread so that the events of
+ * different threads are shown on separate tracks. */
+static ulong renf_trace_chrome_tid(void)
+{
+    pthread_t self = pthread_self();
+    const unsigned char * bytes = (const unsigned char *) &self;
+    ulong tid = 0;
+    size_t i;
+
+    for (i = 0; i < sizeof(pthread_t); i++)
+        tid = tid * 31 + bytes[i];
+
+    return tid % 1000000;
+}
+
+static void renf_trace_chrome_write(const renf_trace_event * event, void * data)
+{
+    (void) data;
+
+    pthread_mutex_lock(&renf_trace_chrome_mutex);
+
+    if (renf_trace_chrome_file != NULL)
+    {
+        fprintf(renf_trace_chrome_file,
+            "%s{\"name\": \"%s\", \"cat\": \"e-antic\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, \"tid\": %lu, "
+            "\"args\": {\"field\": \"%p\", \"degree\": %ld, \"prec_before\": %ld, \"prec_after\": %ld}}",
+            renf_trace_chrome_empty ? "\n" : ",\n",
+            renf_trace_kind_name(event->kind),
+            (event->start > renf_trace_chrome_origin ? event->start - renf_trace_chrome_origin : 0) / 1000.,
+            event->nanoseconds / 1000.,
+            (unsigned long) renf_trace_chrome_tid(),
+            (const void *) event->nf,
+            event->nf == NULL ? 0L : (long) fmpq_poly_degree(event->nf->nf->pol),
+            (long) event->prec_before,
+            (long) event->prec_after);
+        renf_trace_chrome_empty = 0;
+    }
+
+    pthread_mutex_unlock(&renf_trace_chrome_mutex);
+}
+
+int renf_trace_chrome_open(const char * path)
+{
+    FILE * file;
+
+    renf_set_trace(NULL, NULL);
+    renf_trace_chrome_close();
+
+    file = fopen(path, "w");
+    if (file == NULL)
+        return 0;
+
+    fputs("[", file);
+
+    pthread_mutex_lock(&renf_trace_chrome_mutex);
+    renf_trace_chrome_file = file;
+    renf_trace_chrome_origin = _renf_trace_now();
+    renf_trace_chrome_empty = 1;
+    pthread_mutex_unlock(&renf_trace_chrome_mutex);
+
+    renf_set_trace(renf_trace_chrome_write, NULL);
+
+    return 1;
+}
+
+void renf_trace_chrome_close(void)
+{
+    if (_renf_trace_callback == renf_trace_chrome_write)
+        renf_set_trace(NULL, NULL);
+
+    pthread_mutex_lock(&renf_trace_chrome_mutex);
+    if (renf_trace_chrome_file != NULL)
+    {
+        fputs("\n]\n", renf_trace_chrome_file);
+        fclose(renf_trace_chrome_file);
+        renf_trace_chrome_file = NULL;
+    }
+    pthread_mutex_unlock(&renf_trace_chrome_mutex);
+}
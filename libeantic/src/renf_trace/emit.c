@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_trace.h"
+
+void _renf_trace_emit(renf_trace_kind kind, const renf * nf, slong prec_before, slong prec_after, ulong start)
+{
+    renf_trace_event event;
+    renf_trace_callback callback = _renf_trace_callback;
+    ulong end;
+
+    /* Tracing might have been disabled while the operation was running. */
+    if (callback == NULL)
+        return;
+
+    end = _renf_trace_now();
+
+    event.kind = kind;
+    event.nf = nf;
+    event.prec_before = prec_before;
+    event.prec_after = prec_after;
+    event.start = start;
+    event.nanoseconds = end > start ? end - start : 0;
+
+    callback(&event, _renf_trace_data);
+}
@@ -0,0 +1,34 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_trace.h"
+
+const char * renf_trace_kind_name(renf_trace_kind kind)
+{
+    switch (kind)
+    {
+        case RENF_TRACE_REFINE_EMBEDDING:
+            return "refine_embedding";
+        case RENF_TRACE_ESCALATION:
+            return "escalation";
+        case RENF_TRACE_CONSTRUCTION:
+            return "construction";
+        case RENF_TRACE_REGISTRY_LOOKUP:
+            return "registry_lookup";
+        case RENF_TRACE_SERIALIZATION:
+            return "serialization";
+        case RENF_TRACE_DESERIALIZATION:
+            return "deserialization";
+    }
+    return "unknown";
+}
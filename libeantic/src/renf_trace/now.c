@@ -0,0 +1,39 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_trace.h"
+
+ulong _renf_trace_now(void)
+{
+    ulong ns;
+
+#if defined(_WIN32)
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    ns = (ulong) ((double) counter.QuadPart * 1e9 / (double) frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ns = (ulong) ts.tv_sec * 1000000000 + (ulong) ts.tv_nsec;
+#endif
+
+    /* A timestamp of 0 means that tracing is disabled, see _renf_trace_start(). */
+    return ns + 1;
+}
@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_trace.h"
+
+renf_trace_callback _renf_trace_callback = NULL;
+
+void * _renf_trace_data = NULL;
+
+void renf_set_trace(renf_trace_callback callback, void * data)
+{
+    _renf_trace_callback = NULL;
+    _renf_trace_data = data;
+    _renf_trace_callback = callback;
+}
+
+renf_trace_callback renf_get_trace(void ** data)
+{
+    if (data != NULL)
+        *data = _renf_trace_data;
+    return _renf_trace_callback;
+}
@@ -0,0 +1,62 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_add(renf_vec_t res, const renf_vec_t u, const renf_vec_t v)
+{
+    const slong len = u->length * u->degree;
+    fmpz_t den, su, sv;
+
+    if (u->length != v->length || res->length != u->length)
+    {
+        fprintf(stderr, "renf_vec_add: vectors of different length\n");
+        abort();
+    }
+
+    if (u == v)
+    {
+        _fmpz_vec_scalar_mul_2exp(res->num, u->num, len, 1);
+        fmpz_set(&res->den, &u->den);
+        _renf_vec_canonicalise(res);
+        return;
+    }
+
+    if (res == v)
+    {
+        /* Addition is commutative, so we can always update res in place. */
+        const renf_vec * t = u;
+        u = v;
+        v = t;
+    }
+
+    fmpz_init(den);
+    fmpz_init(su);
+    fmpz_init(sv);
+
+    /* Bring both vectors to the least common denominator. Only the shared
+     * denominators need to be compared, not the ones of every entry. */
+    fmpz_lcm(den, &u->den, &v->den);
+    fmpz_divexact(su, den, &u->den);
+    fmpz_divexact(sv, den, &v->den);
+
+    _fmpz_vec_scalar_mul_fmpz(res->num, u->num, len, su);
+    _fmpz_vec_scalar_addmul_fmpz(res->num, v->num, len, sv);
+    fmpz_swap(&res->den, den);
+
+    _renf_vec_canonicalise(res);
+
+    fmpz_clear(den);
+    fmpz_clear(su);
+    fmpz_clear(sv);
+}
@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void _renf_vec_canonicalise(renf_vec_t v)
+{
+    const slong len = v->length * v->degree;
+    slong i;
+    fmpz_t g;
+
+    if (fmpz_sgn(&v->den) < 0)
+    {
+        _fmpz_vec_neg(v->num, v->num, len);
+        fmpz_neg(&v->den, &v->den);
+    }
+
+    if (fmpz_is_one(&v->den))
+        return;
+
+    fmpz_init(g);
+
+    /* Stop as soon as the gcd drops to one; for typical vectors this
+     * happens after very few entries. For the zero vector, the gcd is the
+     * denominator itself which then becomes one. */
+    fmpz_set(g, &v->den);
+    for (i = 0; i < len && !fmpz_is_one(g); i++)
+        if (!fmpz_is_zero(v->num + i))
+            fmpz_gcd(g, g, v->num + i);
+
+    if (!fmpz_is_one(g))
+    {
+        _fmpz_vec_scalar_divexact_fmpz(v->num, v->num, len, g);
+        fmpz_divexact(&v->den, &v->den, g);
+    }
+
+    fmpz_clear(g);
+}
@@ -0,0 +1,21 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_clear(renf_vec_t v)
+{
+    if (v->num != NULL)
+        _fmpz_vec_clear(v->num, v->length * v->degree);
+    fmpz_clear(&v->den);
+}
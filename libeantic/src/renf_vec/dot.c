@@ -0,0 +1,73 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <flint/fmpz_poly.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_dot(renf_elem_t res, const renf_vec_t u, const renf_vec_t v, renf_t nf)
+{
+    slong i;
+    const slong d = u->degree;
+    fmpz * s;
+    fmpz * t;
+    fmpq_poly_t p;
+
+    if (u->length != v->length)
+    {
+        fprintf(stderr, "renf_vec_dot: vectors of different length\n");
+        abort();
+    }
+
+    fmpq_poly_init(p);
+    fmpq_poly_fit_length(p, 2 * d - 1);
+
+    s = fmpq_poly_numref(p);
+    _fmpz_vec_zero(s, 2 * d - 1);
+
+    if (d == 1)
+    {
+        for (i = 0; i < u->length; i++)
+            fmpz_addmul(s, u->num + i, v->num + i);
+    }
+    else
+    {
+        t = _fmpz_vec_init(2 * d - 1);
+
+        for (i = 0; i < u->length; i++)
+        {
+            const fmpz * a = u->num + i * d;
+            const fmpz * b = v->num + i * d;
+
+            if (_fmpz_vec_is_zero(a, d) || _fmpz_vec_is_zero(b, d))
+                continue;
+
+            _fmpz_poly_mul(t, a, d, b, d);
+            _fmpz_vec_add(s, s, t, 2 * d - 1);
+        }
+
+        _fmpz_vec_clear(t, 2 * d - 1);
+    }
+
+    fmpz_mul(fmpq_poly_denref(p), &u->den, &v->den);
+    _fmpq_poly_set_length(p, 2 * d - 1);
+    fmpq_poly_canonicalise(p);
+
+    /* Only the sum is reduced modulo the defining polynomial. */
+    if (fmpq_poly_length(p) > d)
+        fmpq_poly_rem(p, p, nf->nf->pol);
+
+    renf_elem_set_fmpq_poly(res, p, nf);
+
+    fmpq_poly_clear(p);
+}
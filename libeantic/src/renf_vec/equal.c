@@ -0,0 +1,20 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+int renf_vec_equal(const renf_vec_t u, const renf_vec_t v)
+{
+    /* The representation is canonical, so we can compare it directly. */
+    return u->length == v->length && fmpz_equal(&u->den, &v->den) && _fmpz_vec_equal(u->num, v->num, u->length * u->degree);
+}
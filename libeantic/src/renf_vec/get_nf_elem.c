@@ -0,0 +1,42 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void _renf_vec_get_nf_elem(nf_elem_t a, const renf_vec_t v, slong i, const renf_t nf)
+{
+    const fmpz * num = v->num + i * v->degree;
+
+    if (nf->nf->flag & NF_LINEAR)
+    {
+        fmpz_set(LNF_ELEM_NUMREF(a), num);
+        fmpz_set(LNF_ELEM_DENREF(a), &v->den);
+    }
+    else if (nf->nf->flag & NF_QUADRATIC)
+    {
+        _fmpz_vec_set(QNF_ELEM_NUMREF(a), num, 2);
+        fmpz_zero(QNF_ELEM_NUMREF(a) + 2);
+        fmpz_set(QNF_ELEM_DENREF(a), &v->den);
+    }
+    else
+    {
+        fmpq_poly_fit_length(NF_ELEM(a), v->degree);
+        _fmpz_vec_set(NF_ELEM_NUMREF(a), num, v->degree);
+        fmpz_set(NF_ELEM_DENREF(a), &v->den);
+        _fmpq_poly_set_length(NF_ELEM(a), v->degree);
+        _fmpq_poly_normalise(NF_ELEM(a));
+    }
+
+    /* The entry on its own might have a smaller denominator than the vector. */
+    nf_elem_canonicalise(a, nf->nf);
+}
@@ -0,0 +1,22 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_init(renf_vec_t v, slong len, const renf_t nf)
+{
+    v->length = len;
+    v->degree = fmpq_poly_degree(nf->nf->pol);
+    v->num = len ? _fmpz_vec_init(len * v->degree) : NULL;
+    fmpz_init_set_ui(&v->den, 1);
+}
@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_neg(renf_vec_t res, const renf_vec_t v)
+{
+    if (res->length != v->length)
+    {
+        fprintf(stderr, "renf_vec_neg: vectors of different length\n");
+        abort();
+    }
+
+    _fmpz_vec_neg(res->num, v->num, v->length * v->degree);
+    fmpz_set(&res->den, &v->den);
+}
@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_primitive_part(renf_vec_t res, const renf_vec_t v)
+{
+    const slong len = v->length * v->degree;
+    fmpz_t g;
+
+    if (res->length != v->length)
+    {
+        fprintf(stderr, "renf_vec_primitive_part: vectors of different length\n");
+        abort();
+    }
+
+    fmpz_init(g);
+
+    /* Since v is canonical, dividing by the denominator does not change the
+     * content of the numerators. */
+    _fmpz_vec_content(g, v->num, len);
+
+    if (fmpz_is_zero(g) || fmpz_is_one(g))
+        _fmpz_vec_set(res->num, v->num, len);
+    else
+        _fmpz_vec_scalar_divexact_fmpz(res->num, v->num, len, g);
+
+    fmpz_one(&res->den);
+
+    fmpz_clear(g);
+}
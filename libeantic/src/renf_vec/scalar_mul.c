@@ -0,0 +1,100 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_scalar_mul(renf_vec_t res, const renf_vec_t v, const renf_elem_t a, renf_t nf)
+{
+    slong i;
+    fmpz_t s, d;
+    fmpq_poly_t p, q;
+    fmpz * num;
+    fmpz * den;
+
+    if (res->length != v->length)
+    {
+        fprintf(stderr, "renf_vec_scalar_mul: vectors of different length\n");
+        abort();
+    }
+
+    if (nf_elem_is_rational(a->elem, nf->nf))
+    {
+        fmpq_t c;
+        fmpq_init(c);
+        nf_elem_get_coeff_fmpq(c, a->elem, 0, nf->nf);
+        renf_vec_scalar_mul_fmpq(res, v, c);
+        fmpq_clear(c);
+        return;
+    }
+
+    fmpz_init(s);
+    fmpz_init_set(d, &v->den);
+    fmpq_poly_init(p);
+    fmpq_poly_init(q);
+    num = _fmpz_vec_init(v->length * v->degree);
+    den = _fmpz_vec_init(v->length);
+
+    nf_elem_get_fmpq_poly(q, a->elem, nf->nf);
+
+    /* Multiply the integral numerators of the entries with a and reduce
+     * modulo the defining polynomial. This introduces a denominator for
+     * each entry which we then bring to a common denominator. */
+    for (i = 0; i < v->length; i++)
+    {
+        const fmpz * entry = v->num + i * v->degree;
+        slong len = v->degree;
+
+        while (len > 0 && fmpz_is_zero(entry + len - 1))
+            len--;
+
+        if (len == 0)
+        {
+            fmpz_one(den + i);
+            continue;
+        }
+
+        fmpq_poly_fit_length(p, len);
+        _fmpz_vec_set(fmpq_poly_numref(p), entry, len);
+        fmpz_one(fmpq_poly_denref(p));
+        _fmpq_poly_set_length(p, len);
+
+        fmpq_poly_mul(p, p, q);
+        fmpq_poly_rem(p, p, nf->nf->pol);
+
+        _fmpz_vec_set(num + i * v->degree, fmpq_poly_numref(p), fmpq_poly_length(p));
+        fmpz_set(den + i, fmpq_poly_denref(p));
+    }
+
+    /* From here on, res->den is overwritten, so we must not read v->den
+     * anymore since res and v might be the same vector. */
+    fmpz_one(&res->den);
+    for (i = 0; i < v->length; i++)
+        fmpz_lcm(&res->den, &res->den, den + i);
+
+    for (i = 0; i < v->length; i++)
+    {
+        fmpz_divexact(s, &res->den, den + i);
+        _fmpz_vec_scalar_mul_fmpz(res->num + i * v->degree, num + i * v->degree, v->degree, s);
+    }
+
+    fmpz_mul(&res->den, &res->den, d);
+
+    _renf_vec_canonicalise(res);
+
+    _fmpz_vec_clear(num, v->length * v->degree);
+    _fmpz_vec_clear(den, v->length);
+    fmpz_clear(s);
+    fmpz_clear(d);
+    fmpq_poly_clear(p);
+    fmpq_poly_clear(q);
+}
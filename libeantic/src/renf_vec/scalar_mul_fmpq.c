@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_scalar_mul_fmpq(renf_vec_t res, const renf_vec_t v, const fmpq_t c)
+{
+    renf_vec_scalar_mul_fmpz(res, v, fmpq_numref(c));
+
+    if (!fmpz_is_one(fmpq_denref(c)))
+    {
+        fmpz_mul(&res->den, &res->den, fmpq_denref(c));
+        _renf_vec_canonicalise(res);
+    }
+}
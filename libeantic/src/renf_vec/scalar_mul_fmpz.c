@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_scalar_mul_fmpz(renf_vec_t res, const renf_vec_t v, const fmpz_t c)
+{
+    fmpz_t g;
+
+    if (res->length != v->length)
+    {
+        fprintf(stderr, "renf_vec_scalar_mul_fmpz: vectors of different length\n");
+        abort();
+    }
+
+    if (fmpz_is_zero(c))
+    {
+        renf_vec_zero(res);
+        return;
+    }
+
+    /* Since v is canonical, the result is canonical once the common factor
+     * of c and the denominator has been cancelled. */
+    fmpz_init(g);
+    fmpz_gcd(g, c, &v->den);
+
+    if (fmpz_is_one(g))
+    {
+        _fmpz_vec_scalar_mul_fmpz(res->num, v->num, v->length * v->degree, c);
+        fmpz_set(&res->den, &v->den);
+    }
+    else
+    {
+        fmpz_t s;
+        fmpz_init(s);
+        fmpz_divexact(s, c, g);
+        _fmpz_vec_scalar_mul_fmpz(res->num, v->num, v->length * v->degree, s);
+        fmpz_divexact(&res->den, &v->den, g);
+        fmpz_clear(s);
+    }
+
+    fmpz_clear(g);
+}
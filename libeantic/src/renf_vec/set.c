@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_set(renf_vec_t u, const renf_vec_t v)
+{
+    if (u == v)
+        return;
+
+    if (u->length != v->length)
+    {
+        fprintf(stderr, "renf_vec_set: vectors of different length\n");
+        abort();
+    }
+
+    _fmpz_vec_set(u->num, v->num, v->length * v->degree);
+    fmpz_set(&u->den, &v->den);
+}
@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_set_entry(renf_vec_t v, slong i, const renf_elem_t a, const renf_t nf)
+{
+    fmpq_poly_t p;
+    fmpz_t den, s;
+
+    if (i < 0 || i >= v->length)
+    {
+        fprintf(stderr, "renf_vec_set_entry: index out of range\n");
+        abort();
+    }
+
+    fmpq_poly_init(p);
+    fmpz_init(den);
+    fmpz_init(s);
+
+    nf_elem_get_fmpq_poly(p, a->elem, nf->nf);
+
+    /* Rescale the other entries to the common denominator of the vector and a. */
+    fmpz_lcm(den, &v->den, fmpq_poly_denref(p));
+    fmpz_divexact(s, den, &v->den);
+    if (!fmpz_is_one(s))
+        _fmpz_vec_scalar_mul_fmpz(v->num, v->num, v->length * v->degree, s);
+    fmpz_swap(den, &v->den);
+
+    fmpz_divexact(s, &v->den, fmpq_poly_denref(p));
+    _fmpz_vec_scalar_mul_fmpz(v->num + i * v->degree, fmpq_poly_numref(p), fmpq_poly_length(p), s);
+    _fmpz_vec_zero(v->num + i * v->degree + fmpq_poly_length(p), v->degree - fmpq_poly_length(p));
+
+    /* The entry we replaced might have been the only one that needed the
+     * full denominator. */
+    _renf_vec_canonicalise(v);
+
+    fmpq_poly_clear(p);
+    fmpz_clear(den);
+    fmpz_clear(s);
+}
@@ -0,0 +1,61 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+void renf_vec_sub(renf_vec_t res, const renf_vec_t u, const renf_vec_t v)
+{
+    const slong len = u->length * u->degree;
+    fmpz_t den, su, sv;
+
+    if (u->length != v->length || res->length != u->length)
+    {
+        fprintf(stderr, "renf_vec_sub: vectors of different length\n");
+        abort();
+    }
+
+    if (u == v)
+    {
+        renf_vec_zero(res);
+        return;
+    }
+
+    fmpz_init(den);
+    fmpz_init(su);
+    fmpz_init(sv);
+
+    fmpz_lcm(den, &u->den, &v->den);
+    fmpz_divexact(su, den, &u->den);
+    fmpz_divexact(sv, den, &v->den);
+
+    if (res == v)
+    {
+        /* Compute -v + u so that v is read before it is overwritten. */
+        fmpz_neg(sv, sv);
+        _fmpz_vec_scalar_mul_fmpz(res->num, v->num, len, sv);
+        _fmpz_vec_scalar_addmul_fmpz(res->num, u->num, len, su);
+    }
+    else
+    {
+        _fmpz_vec_scalar_mul_fmpz(res->num, u->num, len, su);
+        _fmpz_vec_scalar_submul_fmpz(res->num, v->num, len, sv);
+    }
+
+    fmpz_swap(&res->den, den);
+
+    _renf_vec_canonicalise(res);
+
+    fmpz_clear(den);
+    fmpz_clear(su);
+    fmpz_clear(sv);
+}
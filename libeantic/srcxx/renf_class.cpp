@@ -10,18 +10,24 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <iostream>
 #include <atomic>
 #include <mutex>
 #include <stdexcept>
 #include <type_traits>
 #include <unordered_set>
+#include <memory>
+#include <vector>
 
 #include "../e-antic/config.h"
 
 #include "../e-antic/renf_class.hpp"
 #include "../e-antic/renf_elem_class.hpp"
 #include "../e-antic/fmpq_poly_extra.h"
+#include "../e-antic/renf_cache.h"
+#include "../e-antic/renf_hom.h"
+#include "../e-antic/renf_trace.h"
 
 namespace eantic {
 
@@ -57,6 +63,77 @@ static std::unordered_set<const renf_class*, fields_hasher, fields_equality> fie
 // A mutex to lock any access to the global field registry.
 static std::mutex fields_mutex;
 
+// A mutex to lock any access to the embeddings registered with
+// renf_class::register_embedding().
+static std::mutex embeddings_mutex;
+
+// The callback installed with renf_class::set_trace(). Events are reported
+// on a copy of the pointer so that the callback can be replaced while other
+// threads are still invoking the previous one.
+static std::shared_ptr<const std::function<void(const renf_trace_event&)>> trace;
+
+// A mutex that protects `trace`.
+static std::mutex trace_mutex;
+
+// Return the field in the registry that equals `key`. If there is no such
+// field, `key` is registered and returned. Otherwise, `key` is destroyed.
+boost::intrusive_ptr<const renf_class> intern(const renf_class* key)
+{
+    const ulong start = _renf_trace_start();
+
+    boost::intrusive_ptr<const renf_class> field;
+
+    {
+        std::lock_guard<std::mutex> lock(fields_mutex);
+
+        const auto entry = fields.find(key);
+
+        if (entry == fields.end())
+        {
+            try
+            {
+                fields.insert(key);
+            }
+            catch (...)
+            {
+                delete key;
+                throw;
+            }
+            field = key;
+        }
+        else
+        {
+            delete key;
+            field = *entry;
+        }
+    }
+
+    _renf_trace(RENF_TRACE_REGISTRY_LOOKUP, field->renf_t(), field->renf_t()->prec, field->renf_t()->prec, start);
+
+    return field;
+}
+
+// Owns a C object such as a renf_t until another object takes it over.
+template <typename T, void (*clear)(T*)>
+struct guard {
+    explicit guard(T* value) : value(value) {}
+    guard(const guard&) = delete;
+    guard& operator=(const guard&) = delete;
+    ~guard() { if (value != nullptr) clear(value); }
+
+    T* release()
+    {
+        T* ret = value;
+        value = nullptr;
+        return ret;
+    }
+
+    T* value;
+};
+
+using renf_guard = guard<::renf, renf_clear>;
+using renf_hom_guard = guard<::renf_hom, renf_hom_clear>;
+
 }
 
 static_assert(!std::is_default_constructible<renf_class>::value, "renf_class should have implicitly deleted its default constructor; since there can only be one default renf_class() we must not allow for a default constructor.");
@@ -65,7 +142,32 @@ static_assert(!std::is_move_constructible<renf_class>::value, "renf_class should
 static_assert(!std::is_copy_assignable<renf_class>::value, "renf_class should have implicitly deleted its assignment operator; since it is only accessible through intrusive pointers, there must be no copies at other memory addresses");
 static_assert(!std::is_move_assignable<renf_class>::value, "renf_class should have implicitly deleted its assignment operator; since it is only accessible through intrusive pointers, the address must be stable for the entire lifetime");
 
-renf_class::renf_class(const ::renf_t k, const std::string & gen_name) : name(gen_name), refcount(0)
+struct renf_class::embeddings {
+    struct embedding {
+        // Take ownership of `hom`.
+        embedding(const renf_class& target, ::renf_hom_t hom) : target(&target)
+        {
+            *this->hom = *hom;
+        }
+
+        ~embedding() { renf_hom_clear(hom); }
+
+        // The field this field embeds into. This does not keep the target
+        // alive (otherwise, embeddings in both directions would keep both
+        // fields alive forever.) Instead, the embedding is removed when the
+        // target is destroyed.
+        const renf_class* target;
+        ::renf_hom_t hom;
+    };
+
+    // The embeddings of this field into other fields.
+    std::vector<std::unique_ptr<embedding>> entries;
+
+    // The fields that have an embedding into this field.
+    std::vector<const renf_class*> sources;
+};
+
+renf_class::renf_class(const ::renf_t k, const std::string & gen_name) : name(gen_name), refcount(0), homs(nullptr)
 {
     renf_init_set(nf, k);
 
@@ -78,6 +180,19 @@ renf_class::renf_class(const ::renf_t k, const std::string & gen_name) : name(ge
     renf_elem_gen(cache[2].renf_elem_t(), renf_t());
 }
 
+renf_class::renf_class(::renf_t k, const std::string & gen_name, adopt_t) : name(gen_name), refcount(0), homs(nullptr)
+{
+    *nf = *k;
+
+    // We prepare a cache of 0,1, and the generator of this field.
+    cache = new renf_elem_class[3] {
+        renf_elem_class(*this),
+        renf_elem_class(*this, 1),
+        renf_elem_class(*this),
+    };
+    renf_elem_gen(cache[2].renf_elem_t(), renf_t());
+}
+
 const renf_class& renf_class::make()
 {
     // We cache our standard rational field in a static variable.
@@ -93,22 +208,7 @@ const renf_class& renf_class::make()
 
 boost::intrusive_ptr<const renf_class> renf_class::make(const ::renf_t k, const std::string & gen_name)
 {
-    const auto* key = new renf_class(k, gen_name);
-
-    std::lock_guard<std::mutex> lock(fields_mutex);
-
-    const auto entry = fields.find(key);
-
-    if (entry == fields.end())
-    {
-        fields.insert(key);
-        return key;
-    }
-    else
-    {
-        delete key;
-        return *entry;
-    }
+    return intern(new renf_class(k, gen_name));
 }
 
 boost::intrusive_ptr<const renf_class> renf_class::make(const std::string & minpoly, const std::string & gen, const std::string & emb, const slong prec)
@@ -122,50 +222,120 @@ boost::intrusive_ptr<const renf_class> renf_class::make(const std::string & minp
 }
 
 boost::intrusive_ptr<const renf_class> renf_class::make(const std::string & minpoly, const std::string& gen, const std::function<std::string(slong prec)> emb, slong prec) {
-    while (true)
+    const ulong start = _renf_trace_start();
+
+    fmpq_poly_t p;
+    fmpq_poly_init(p);
+    if (fmpq_poly_set_str_pretty(p, minpoly.c_str(), gen.c_str()))
     {
-        arb_t e;
-        fmpq_poly_t p;
+        fmpq_poly_clear(p);
+        throw std::invalid_argument("renf_class: can not read polynomial from string");
+    }
 
-        fmpq_poly_init(p);
-        if (fmpq_poly_set_str_pretty(p, minpoly.c_str(), gen.c_str()))
+    // Only the approximation of the embedding depends on the precision. We
+    // increase the precision until the approximation isolates a root.
+    arb_t e, cached;
+    arb_init(e);
+    arb_init(cached);
+    renf_cache* cache = renf_get_cache();
+    bool hit = false;
+    while (true)
+    {
+        std::string approximation;
+        try
+        {
+            approximation = emb(prec);
+        }
+        catch (...)
         {
             fmpq_poly_clear(p);
-            throw std::invalid_argument("renf_class: can not read polynomial from string");
+            arb_clear(e);
+            arb_clear(cached);
+            throw;
         }
 
-        arb_init(e);
-        if (arb_set_str(e, emb(prec).c_str(), prec))
+        if (arb_set_str(e, approximation.c_str(), prec))
         {
             fmpq_poly_clear(p);
             arb_clear(e);
+            arb_clear(cached);
             throw std::invalid_argument("renf_class: can not read ball from string");
         }
 
-        if (!fmpq_poly_check_unique_real_root(p, e, prec))
+        if (cache != nullptr && fmpq_poly_length(p) > 2 && renf_cache_get(cached, cache, p, e, prec))
         {
-            fmpq_poly_clear(p);
-            arb_clear(e);
-            prec *= 2;
-            continue;
+            hit = true;
+            break;
         }
 
-        ::renf_t nf;
-        renf_init(nf, p, e, prec);
+        if (fmpq_poly_check_unique_real_root(p, e, prec))
+            break;
 
-        fmpq_poly_clear(p);
-        arb_clear(e);
+        prec *= 2;
+    }
+
+    // The root has been certified above (or when it was put into the cache)
+    // so we skip the check in renf_init().
+    ::renf_t nf;
+    if (hit)
+    {
+        _renf_init(nf, p, cached, prec);
+    }
+    else
+    {
+        _renf_init(nf, p, e, prec);
+        if (!(nf->nf->flag & NF_LINEAR))
+        {
+            renf_refine_embedding(nf, prec);
+            if (cache != nullptr)
+                renf_cache_set(cache, p, e, nf->emb, prec);
+        }
+    }
 
-        auto field = make(nf, gen);
+    renf_guard nf_guard(nf);
 
-        renf_clear(nf);
+    const slong accuracy = arb_rel_accuracy_bits(e);
 
-        return field;
-    }
+    fmpq_poly_clear(p);
+    arb_clear(e);
+    arb_clear(cached);
+
+    // The field takes ownership of nf, so nf must only be cleared if its
+    // construction fails. Once constructed, intern() takes care of the field.
+    auto* adopted = new renf_class(nf, gen, adopt_t{});
+    nf_guard.release();
+    auto field = intern(adopted);
+
+    _renf_trace(RENF_TRACE_CONSTRUCTION, field->renf_t(), accuracy, arb_rel_accuracy_bits(field->renf_t()->emb), start);
+
+    return field;
 }
 
 renf_class::~renf_class() noexcept
 {
+    if (homs != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(embeddings_mutex);
+
+        // Forget the embeddings into this field.
+        for (const renf_class* source : homs->sources)
+        {
+            auto& entries = source->homs->entries;
+            entries.erase(std::remove_if(entries.begin(), entries.end(), [&](const std::unique_ptr<embeddings::embedding>& e) { return e->target == this; }), entries.end());
+        }
+
+        // Forget that the targets of our embeddings have an embedding from
+        // this field.
+        for (const auto& e : homs->entries)
+        {
+            auto& sources = e->target->homs->sources;
+            sources.erase(std::remove(sources.begin(), sources.end(), this), sources.end());
+        }
+    }
+
+    renf_elem_class::forget_mixed_parents(*this);
+
+    delete homs;
     delete[] cache;
     assert(refcount == 0 && "All references to this number field must have been destroyed when this field is deleted. There seems to be an error in the reference counting.");
     renf_clear(nf);
@@ -173,6 +343,105 @@ renf_class::~renf_class() noexcept
 
 slong renf_class::degree() const { return fmpq_poly_degree(nf->nf->pol); }
 
+renf_statistics renf_class::statistics() const
+{
+    renf_statistics statistics;
+    renf_get_statistics(&statistics, nf);
+    return statistics;
+}
+
+void renf_class::reset_statistics() const
+{
+    renf_reset_statistics(nf);
+}
+
+void renf_class::register_embedding(const renf_elem_class& image) const
+{
+    const renf_class& L = image.parent();
+
+    if (&L == this)
+        throw std::invalid_argument("cannot register an embedding of a number field into itself");
+
+    if (has_embedding(L))
+        return;
+
+    ::renf_hom_t hom;
+    if (!renf_hom_init(hom, renf_t(), image.renf_elem_t(), L.renf_t()))
+        throw std::invalid_argument("there is no embedding that sends the generator to this element");
+
+    renf_hom_guard hom_guard(hom);
+    std::unique_ptr<embeddings::embedding> entry(new embeddings::embedding(L, hom));
+    hom_guard.release();
+
+    std::lock_guard<std::mutex> lock(embeddings_mutex);
+
+    if (homs == nullptr)
+        homs = new embeddings();
+    if (L.homs == nullptr)
+        L.homs = new embeddings();
+
+    for (const auto& e : homs->entries)
+        if (e->target == &L)
+            return;
+
+    // Reserve first so that both sides of the embedding are recorded or
+    // none of them.
+    homs->entries.reserve(homs->entries.size() + 1);
+    L.homs->sources.reserve(L.homs->sources.size() + 1);
+
+    homs->entries.push_back(std::move(entry));
+    L.homs->sources.push_back(this);
+}
+
+bool renf_class::has_embedding(const renf_class& L) const
+{
+    return embedding(L) != nullptr;
+}
+
+const ::renf_hom* renf_class::embedding(const renf_class& L) const
+{
+    std::lock_guard<std::mutex> lock(embeddings_mutex);
+
+    if (homs == nullptr)
+        return nullptr;
+
+    // Entries are only removed when this field or L is destroyed, so the
+    // embedding outlives the lock.
+    for (const auto& e : homs->entries)
+        if (e->target == &L)
+            return e->hom;
+
+    return nullptr;
+}
+
+void renf_class::set_trace(std::function<void(const renf_trace_event&)> callback)
+{
+    std::shared_ptr<const std::function<void(const renf_trace_event&)>> installed;
+    if (callback)
+        installed = std::make_shared<const std::function<void(const renf_trace_event&)>>(std::move(callback));
+
+    // The previous callback ends up in `installed` and is destroyed once the
+    // lock has been released and no other thread is running it anymore.
+    {
+        std::lock_guard<std::mutex> lock(trace_mutex);
+
+        std::swap(trace, installed);
+
+        if (trace)
+            renf_set_trace([](const renf_trace_event* event, void*) {
+                std::shared_ptr<const std::function<void(const renf_trace_event&)>> callback;
+                {
+                    std::lock_guard<std::mutex> lock(trace_mutex);
+                    callback = trace;
+                }
+                if (callback)
+                    (*callback)(*event);
+            }, nullptr);
+        else
+            renf_set_trace(nullptr, nullptr);
+    }
+}
+
 const renf_elem_class& renf_class::zero() const
 {
     return cache[0];
@@ -294,10 +563,13 @@ void intrusive_ptr_release(const renf_class* nf) {
         // We remove this field from the registry of fields and then free the
         // memory it is occupying.
 
-        std::lock_guard<std::mutex> lock(fields_mutex);
+        {
+            std::lock_guard<std::mutex> lock(fields_mutex);
+
+            assert(fields.find(nf) != fields.end());
+            fields.erase(nf);
+        }
 
-        assert(fields.find(nf) != fields.end());
-        fields.erase(nf);
         delete(nf);
     }
 }
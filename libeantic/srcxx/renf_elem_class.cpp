@@ -11,7 +11,11 @@
 */
 
 #include <iostream>
+#include <atomic>
 #include <cassert>
+#include <mutex>
+#include <set>
+#include <utility>
 #include <gmp.h>
 #include <flint/fmpq.h>
 #include <cstdlib>
@@ -27,6 +31,7 @@
 #include "../e-antic/renf_elem_class.hpp"
 
 #include "../e-antic/renf_elem.h"
+#include "../e-antic/renf_hom.h"
 #include "../e-antic/fmpq_poly_extra.h"
 
 namespace eantic {
@@ -77,6 +82,57 @@ const fmpq_t& renf_elem_get_fmpq(fmpq_t buffer, const renf_elem_t a, const renf_
     }
 }
 
+// The policy for deprecated arithmetic between different number fields,
+// see renf_elem_class::set_mixed_parents().
+std::atomic<renf_elem_class::mixed_parents>& mixed_parents_policy()
+{
+    static std::atomic<renf_elem_class::mixed_parents> policy(
+        getenv("LIBEANTIC_STRICT_BINOP") == nullptr ? renf_elem_class::mixed_parents::warn_once : renf_elem_class::mixed_parents::raise);
+    return policy;
+}
+
+// The number of deprecated operations between different number fields.
+std::atomic<size_t> mixed_parents_operations(0);
+
+// A mutex that protects the pairs of fields we warned about and serializes
+// the warnings so that they do not interleave.
+std::mutex mixed_parents_mutex;
+
+// The pairs of number fields for which a deprecation warning has been printed.
+std::set<std::pair<const renf_class*, const renf_class*>> mixed_parents_warned;
+
+// Handle an arithmetic operation between elements of the fields `lhs` and
+// `rhs` according to the policy set with renf_elem_class::set_mixed_parents().
+void mixed_parents_deprecation(const renf_class& lhs, const renf_class& rhs)
+{
+    static const char* message = "Performing arithmetic on number field elements in different fields has been deprecated. Make sure to bring the elements into the same field or the rational field explicitly before performing arithmetic on them. See https://github.com/flatsurf/e-antic/issues/126.";
+
+    mixed_parents_operations.fetch_add(1, std::memory_order_relaxed);
+
+    switch (mixed_parents_policy().load(std::memory_order_relaxed))
+    {
+        case renf_elem_class::mixed_parents::raise:
+            throw std::invalid_argument(message);
+        case renf_elem_class::mixed_parents::allow:
+            return;
+        case renf_elem_class::mixed_parents::warn_once:
+        {
+            std::lock_guard<std::mutex> lock(mixed_parents_mutex);
+            const auto fields = std::less<const renf_class*>()(&lhs, &rhs) ? std::make_pair(&lhs, &rhs) : std::make_pair(&rhs, &lhs);
+            if (!mixed_parents_warned.insert(fields).second)
+                return;
+            std::cerr << message << " This warning is only shown once for each pair of number fields.\n";
+            return;
+        }
+        case renf_elem_class::mixed_parents::warn:
+        {
+            std::lock_guard<std::mutex> lock(mixed_parents_mutex);
+            std::cerr << message << "\n";
+            return;
+        }
+    }
+}
+
 void coerce(renf_elem_class& self, const renf_class& parent)
 {
     if (parent == self.parent())
@@ -97,7 +153,7 @@ void coerce(renf_elem_class& self, const renf_class& parent)
 
         fmpz_clear(value);
     }
-    else if (self.is_rational())
+    else if (self.is_rational() || (parent != renf_class::make() && self.parent().has_embedding(parent)))
     {
         self = renf_elem_class(parent, self);
     }
@@ -118,31 +174,41 @@ renf_elem_class& binop(renf_elem_class& lhs, const renf_elem_class& rhs)
     }
     else
     {
-        if (lhs.parent() != renf_class::make() && rhs.parent() != renf_class::make())
-        {
-            static const char* STRICT_BINOP = getenv("LIBEANTIC_STRICT_BINOP");
+        _renf_count_coercion(lhs.parent().renf_t());
 
-            static const char* message = "Performing arithmetic on number field elements in different fields has been deprecated. Make sure to bring the elements into the same field or the rational field explicitly before performing arithmetic on them. See https://github.com/flatsurf/e-antic/issues/126.";
+        // Arithmetic with the rational field is not deprecated and does not
+        // need to consult the registry of embeddings (which takes a global
+        // lock.)
+        const bool mixed = lhs.parent() != renf_class::make() && rhs.parent() != renf_class::make();
 
-            if (STRICT_BINOP != nullptr)
-                throw std::invalid_argument(message);
-            else
-                std::cerr << message << std::endl;
-        }
-
-        if (rhs.is_integer())
-        {
-            fmpz_op(lhs.renf_elem_t(), lhs.renf_elem_t(), renf_elem_get_fmpz(rhs.renf_elem_t(), rhs.parent().renf_t()), lhs.parent().renf_t());
-        }
-        else if (rhs.is_rational())
+        if (rhs.is_rational())
         {
-            fmpq_t buffer;
-            fmpq_init(buffer);
-            fmpq_op(lhs.renf_elem_t(), lhs.renf_elem_t(), renf_elem_get_fmpq(buffer, rhs.renf_elem_t(), rhs.parent().renf_t()), lhs.parent().renf_t());
-            fmpq_clear(buffer);
+            if (mixed && !rhs.parent().has_embedding(lhs.parent()) && !lhs.parent().has_embedding(rhs.parent()))
+                mixed_parents_deprecation(lhs.parent(), rhs.parent());
+
+            if (rhs.is_integer())
+            {
+                fmpz_op(lhs.renf_elem_t(), lhs.renf_elem_t(), renf_elem_get_fmpz(rhs.renf_elem_t(), rhs.parent().renf_t()), lhs.parent().renf_t());
+            }
+            else
+            {
+                fmpq_t buffer;
+                fmpq_init(buffer);
+                fmpq_op(lhs.renf_elem_t(), lhs.renf_elem_t(), renf_elem_get_fmpq(buffer, rhs.renf_elem_t(), rhs.parent().renf_t()), lhs.parent().renf_t());
+                fmpq_clear(buffer);
+            }
         }
         else
         {
+            if (mixed)
+            {
+                // Use an embedding between the fields if one has been registered.
+                if (rhs.parent().has_embedding(lhs.parent()))
+                    return binop<renf_op, fmpz_op, fmpq_op>(lhs, renf_elem_class(lhs.parent(), rhs));
+                if (!lhs.parent().has_embedding(rhs.parent()))
+                    mixed_parents_deprecation(lhs.parent(), rhs.parent());
+            }
+
             coerce(lhs, rhs.parent());
             binop<renf_op, fmpz_op, fmpq_op>(lhs, rhs);
         }
@@ -605,6 +671,8 @@ renf_elem_class::renf_elem_class(const renf_class& k, const renf_elem_class & va
         renf_elem_set(a, value.renf_elem_t(), nf->renf_t());
     else if (value.is_rational())
         renf_elem_set_mpq(a, static_cast<mpq_class>(value).get_mpq_t(), nf->renf_t());
+    else if (const ::renf_hom* f = value.parent().embedding(parent()))
+        renf_hom_apply(a, value.renf_elem_t(), f, value.parent().renf_t(), nf->renf_t());
     else
         throw std::logic_error("not implemented: coercion between these number fields");
 }
@@ -1101,6 +1169,33 @@ renf_elem_class & renf_elem_class::operator/=(const renf_elem_class & rhs)
     return binop<renf_elem_div, renf_elem_div_fmpz, renf_elem_div_fmpq>(*this, rhs);
 }
 
+void renf_elem_class::set_mixed_parents(mixed_parents policy)
+{
+    mixed_parents_policy().store(policy, std::memory_order_relaxed);
+}
+
+renf_elem_class::mixed_parents renf_elem_class::get_mixed_parents()
+{
+    return mixed_parents_policy().load(std::memory_order_relaxed);
+}
+
+size_t renf_elem_class::mixed_parents_count()
+{
+    return mixed_parents_operations.load(std::memory_order_relaxed);
+}
+
+void renf_elem_class::forget_mixed_parents(const renf_class& nf)
+{
+    std::lock_guard<std::mutex> lock(mixed_parents_mutex);
+    for (auto it = mixed_parents_warned.begin(); it != mixed_parents_warned.end();)
+    {
+        if (it->first == &nf || it->second == &nf)
+            it = mixed_parents_warned.erase(it);
+        else
+            ++it;
+    }
+}
+
 renf_elem_class & renf_elem_class::iaddmul(const renf_elem_class & a, const renf_elem_class & b) {
     return ternop<renf_elem_addmul, renf_elem_addmul_fmpz, renf_elem_addmul_fmpq>(*this, a, b);
 }
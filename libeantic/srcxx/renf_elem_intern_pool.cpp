@@ -0,0 +1,205 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+#include "../e-antic/config.h"
+
+#include "../e-antic/renf_class.hpp"
+#include "../e-antic/renf_elem_class.hpp"
+#include "../e-antic/renf_elem_intern_pool.hpp"
+
+namespace eantic {
+
+namespace {
+
+size_t combine(size_t seed, size_t value)
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+// Return a hash of the exact value of `x`.
+size_t hash(const fmpz_t x)
+{
+    if (!COEFF_IS_MPZ(*x))
+        return std::hash<slong>()(*x);
+
+    const __mpz_struct* z = COEFF_TO_PTR(*x);
+
+    size_t h = std::hash<int>()(z->_mp_size);
+    for (int i = 0; i < std::abs(z->_mp_size); i++)
+        h = combine(h, std::hash<mp_limb_t>()(z->_mp_d[i]));
+    return h;
+}
+
+// Return a hash of the exact value of `a`.
+// Unlike std::hash<renf_elem_class>, which only hashes an approximation, this
+// hash depends on all the coefficients of the (canonical) representation
+// of `a` and rarely collides for distinct elements.
+size_t hash(const renf_elem_t a, const renf_t nf)
+{
+    if (nf->nf->flag & NF_LINEAR)
+    {
+        return combine(hash(LNF_ELEM_NUMREF(a->elem)), hash(LNF_ELEM_DENREF(a->elem)));
+    }
+    else if (nf->nf->flag & NF_QUADRATIC)
+    {
+        size_t h = hash(QNF_ELEM_DENREF(a->elem));
+        h = combine(h, hash(QNF_ELEM_NUMREF(a->elem)));
+        h = combine(h, hash(QNF_ELEM_NUMREF(a->elem) + 1));
+        return h;
+    }
+    else
+    {
+        const slong len = NF_ELEM(a->elem)->length;
+
+        size_t h = combine(std::hash<slong>()(len), hash(NF_ELEM_DENREF(a->elem)));
+        for (slong i = 0; i < len; i++)
+            h = combine(h, hash(NF_ELEM_NUMREF(a->elem) + i));
+        return h;
+    }
+}
+
+}
+
+renf_elem_intern_pool::renf_elem_intern_pool(const renf_class& k, bool evict_unreferenced) : nf(&k), evict_unreferenced(evict_unreferenced), occupied(0) {}
+
+renf_elem_intern_pool::handle renf_elem_intern_pool::intern(const renf_elem_class& x)
+{
+    if (x.parent() != *nf)
+        return intern(renf_elem_class(*nf, x));
+
+    handle h;
+    if (find(x, h))
+    {
+        retain(h);
+        return h;
+    }
+
+    const size_t key = hash(x.renf_elem_t(), nf->renf_t());
+
+    if (unused.empty())
+    {
+        if (slots.size() > std::numeric_limits<handle>::max())
+            throw std::length_error("too many distinct elements in renf_elem_intern_pool");
+
+        h = static_cast<handle>(slots.size());
+        slots.push_back(slot{x, key, 1, true});
+    }
+    else
+    {
+        h = unused.back();
+        unused.pop_back();
+        slots[h] = slot{x, key, 1, true};
+    }
+
+    index.emplace(key, h);
+    occupied++;
+
+    return h;
+}
+
+bool renf_elem_intern_pool::find(const renf_elem_class& x, handle& h) const
+{
+    if (x.parent() != *nf)
+    {
+        if (!x.is_rational())
+            return false;
+        return find(renf_elem_class(*nf, x), h);
+    }
+
+    const auto range = index.equal_range(hash(x.renf_elem_t(), nf->renf_t()));
+
+    for (auto it = range.first; it != range.second; it++)
+    {
+        if (renf_elem_equal(slots[it->second].value.renf_elem_t(), x.renf_elem_t(), nf->renf_t()))
+        {
+            h = it->second;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+const renf_elem_class& renf_elem_intern_pool::operator[](handle h) const
+{
+    assert(h < slots.size() && slots[h].occupied && "handle does not refer to an element of this pool");
+    return slots[h].value;
+}
+
+void renf_elem_intern_pool::retain(handle h)
+{
+    assert(h < slots.size() && slots[h].occupied && "handle does not refer to an element of this pool");
+    slots[h].references++;
+}
+
+void renf_elem_intern_pool::release(handle h)
+{
+    assert(h < slots.size() && slots[h].occupied && "handle does not refer to an element of this pool");
+    assert(slots[h].references > 0 && "handle has been released more often than it has been acquired");
+
+    if (--slots[h].references == 0 && evict_unreferenced)
+        erase(h);
+}
+
+size_t renf_elem_intern_pool::references(handle h) const
+{
+    assert(h < slots.size() && slots[h].occupied && "handle does not refer to an element of this pool");
+    return slots[h].references;
+}
+
+size_t renf_elem_intern_pool::evict()
+{
+    size_t evicted = 0;
+
+    for (size_t h = 0; h < slots.size(); h++)
+    {
+        if (slots[h].occupied && slots[h].references == 0)
+        {
+            erase(static_cast<handle>(h));
+            evicted++;
+        }
+    }
+
+    return evicted;
+}
+
+size_t renf_elem_intern_pool::size() const
+{
+    return occupied;
+}
+
+void renf_elem_intern_pool::erase(handle h)
+{
+    auto range = index.equal_range(slots[h].hash);
+    for (auto it = range.first; it != range.second; it++)
+    {
+        if (it->second == h)
+        {
+            index.erase(it);
+            break;
+        }
+    }
+
+    // Release the memory taken by the element but keep the slot around so
+    // that the handles of other elements remain valid.
+    slots[h].value = nf->zero();
+    slots[h].occupied = false;
+
+    unused.push_back(h);
+    occupied--;
+}
+
+}
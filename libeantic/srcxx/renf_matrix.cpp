@@ -0,0 +1,213 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <ostream>
+#include <stdexcept>
+
+#include "../e-antic/config.h"
+
+#include "../e-antic/renf_class.hpp"
+#include "../e-antic/renf_elem_class.hpp"
+#include "../e-antic/renf_matrix.hpp"
+
+namespace eantic {
+
+renf_matrix::renf_matrix(const renf_class& k, size_t rows, size_t cols) : nf(&k)
+{
+    renf_mat_init(mat, static_cast<slong>(rows), static_cast<slong>(cols), nf->renf_t());
+}
+
+renf_matrix::renf_matrix(const renf_class& k, const std::vector<std::vector<renf_elem_class>>& rows) : renf_matrix(k, rows.size(), rows.empty() ? 0 : rows[0].size())
+{
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        if (rows[i].size() != this->cols())
+            throw std::invalid_argument("all rows of a matrix must have the same length");
+
+        for (size_t j = 0; j < rows[i].size(); j++)
+            set(i, j, rows[i][j]);
+    }
+}
+
+renf_matrix::renf_matrix(const renf_matrix& other) : renf_matrix(*other.nf, other.rows(), other.cols())
+{
+    renf_mat_set(mat, other.mat, nf->renf_t());
+}
+
+renf_matrix::renf_matrix(renf_matrix&& other) noexcept : nf(other.nf)
+{
+    *mat = *other.mat;
+
+    // Leave other as an empty matrix so it can be safely destroyed.
+    other.mat->entries = nullptr;
+    other.mat->rows = nullptr;
+    other.mat->r = 0;
+    other.mat->c = 0;
+}
+
+renf_matrix::~renf_matrix() noexcept
+{
+    renf_mat_clear(mat, nf->renf_t());
+}
+
+renf_matrix& renf_matrix::operator=(const renf_matrix& rhs)
+{
+    if (this != &rhs)
+        *this = renf_matrix(rhs);
+    return *this;
+}
+
+renf_matrix& renf_matrix::operator=(renf_matrix&& rhs) noexcept
+{
+    std::swap(nf, rhs.nf);
+    renf_mat_swap(mat, rhs.mat);
+    return *this;
+}
+
+renf_matrix renf_matrix::identity(const renf_class& k, size_t n)
+{
+    renf_matrix one(k, n, n);
+    renf_mat_one(one.mat, k.renf_t());
+    return one;
+}
+
+size_t renf_matrix::rows() const
+{
+    return static_cast<size_t>(renf_mat_nrows(mat));
+}
+
+size_t renf_matrix::cols() const
+{
+    return static_cast<size_t>(renf_mat_ncols(mat));
+}
+
+void renf_matrix::check(size_t i, size_t j) const
+{
+    if (i >= rows() || j >= cols())
+        throw std::out_of_range("matrix index out of range");
+}
+
+renf_elem_class renf_matrix::operator()(size_t i, size_t j) const
+{
+    check(i, j);
+
+    renf_elem_class value(*nf);
+    renf_elem_set(value.renf_elem_t(), renf_mat_entry(mat, i, j), nf->renf_t());
+    return value;
+}
+
+void renf_matrix::set(size_t i, size_t j, const renf_elem_class& value)
+{
+    check(i, j);
+
+    if (value.parent() != *nf)
+    {
+        set(i, j, renf_elem_class(*nf, value));
+        return;
+    }
+
+    renf_elem_set(renf_mat_entry(mat, i, j), value.renf_elem_t(), nf->renf_t());
+}
+
+const renf_class& renf_matrix::parent() const
+{
+    return *nf;
+}
+
+renf_matrix& renf_matrix::operator*=(const renf_matrix& rhs)
+{
+    if (*nf != *rhs.nf)
+        throw std::invalid_argument("cannot multiply matrices over different number fields");
+    if (cols() != rhs.rows())
+        throw std::invalid_argument("incompatible dimensions for matrix multiplication");
+
+    renf_matrix product(*nf, rows(), rhs.cols());
+    renf_mat_mul(product.mat, mat, rhs.mat, nf->renf_t());
+    return *this = std::move(product);
+}
+
+size_t renf_matrix::rank() const
+{
+    return static_cast<size_t>(renf_mat_rank(mat, nf->renf_t()));
+}
+
+renf_elem_class renf_matrix::det() const
+{
+    if (rows() != cols())
+        throw std::invalid_argument("determinant is only defined for square matrices");
+
+    renf_elem_class det(*nf);
+    renf_mat_det(det.renf_elem_t(), mat, nf->renf_t());
+    return det;
+}
+
+renf_matrix renf_matrix::rref() const
+{
+    renf_matrix echelon(*nf, rows(), cols());
+    renf_mat_rref(echelon.mat, mat, nf->renf_t());
+    return echelon;
+}
+
+renf_matrix renf_matrix::solve(const renf_matrix& b) const
+{
+    if (*nf != *b.nf)
+        throw std::invalid_argument("cannot solve systems over different number fields");
+    if (rows() != b.rows())
+        throw std::invalid_argument("right hand side does not match the number of rows of the system");
+
+    renf_matrix x(*nf, cols(), b.cols());
+    if (!renf_mat_solve(x.mat, mat, b.mat, nf->renf_t()))
+        throw std::invalid_argument("linear system has no solution");
+    return x;
+}
+
+renf_matrix renf_matrix::kernel() const
+{
+    renf_matrix basis(*nf, cols(), cols());
+    const size_t nullity = static_cast<size_t>(renf_mat_nullspace(basis.mat, mat, nf->renf_t()));
+
+    renf_matrix kernel(*nf, cols(), nullity);
+    for (size_t i = 0; i < cols(); i++)
+        for (size_t j = 0; j < nullity; j++)
+            renf_elem_swap(renf_mat_entry(kernel.mat, i, j), renf_mat_entry(basis.mat, i, j));
+    return kernel;
+}
+
+std::add_lvalue_reference_t<::renf_mat_t> renf_matrix::renf_mat_t() const
+{
+    return mat;
+}
+
+bool operator==(const renf_matrix& lhs, const renf_matrix& rhs)
+{
+    return *lhs.nf == *rhs.nf && renf_mat_equal(lhs.mat, rhs.mat, lhs.nf->renf_t());
+}
+
+std::ostream& operator<<(std::ostream& os, const renf_matrix& A)
+{
+    for (size_t i = 0; i < A.rows(); i++)
+    {
+        if (i)
+            os << std::endl;
+
+        os << "[";
+        for (size_t j = 0; j < A.cols(); j++)
+        {
+            if (j)
+                os << ", ";
+            os << A(i, j);
+        }
+        os << "]";
+    }
+    return os;
+}
+
+}
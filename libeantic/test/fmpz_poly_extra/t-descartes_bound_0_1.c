@@ -0,0 +1,70 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#include <flint/fmpz_vec.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    /* Scaling by a large power of two does not change the signs in the  */
+    /* Taylor shift but forces the generic code instead of the word size */
+    /* one. The scratch space is shared between both.                    */
+    for (iter = 0; iter < 1000; iter++)
+    {
+        fmpz_poly_t p, q;
+        fmpz * scratch;
+        slong bound, v1, v2, v3;
+
+        fmpz_poly_init(p);
+        fmpz_poly_init(q);
+
+        fmpz_poly_randtest_not_zero(p, state, 1 + (slong)n_randint(state, 40), 1 + n_randint(state, 20));
+
+        fmpz_poly_scalar_mul_2exp(q, p, 100);
+        bound = (slong)n_randint(state, 4);
+
+        scratch = _fmpz_vec_init(p->length);
+
+        v1 = _fmpz_poly_descartes_bound_0_1_scratch(q->coeffs, q->length, bound, scratch);
+        v2 = _fmpz_poly_descartes_bound_0_1_scratch(p->coeffs, p->length, bound, scratch);
+        v3 = _fmpz_poly_descartes_bound_0_1(p->coeffs, p->length, bound);
+
+        if (v1 != v2 || v1 != v3)
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("bound = %wd\n", bound);
+            flint_printf("(generic) v1 = %wd  (small) v2 = %wd  (allocating) v3 = %wd\n", v1, v2, v3);
+            abort();
+        }
+
+        _fmpz_vec_clear(scratch, p->length);
+        fmpz_poly_clear(p);
+        fmpz_poly_clear(q);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#include <flint/fmpq.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        fmpz_poly_t p;
+        arb_t a, y1, y2, y3;
+        arf_t x;
+        fmpq_t q, v;
+        slong prec = 2 + (slong)n_randint(state, 500);
+
+        fmpz_poly_init(p);
+        arb_init(a);
+        arb_init(y1);
+        arb_init(y2);
+        arb_init(y3);
+        arf_init(x);
+        fmpq_init(q);
+        fmpq_init(v);
+
+        fmpz_poly_randtest(p, state, (slong)n_randint(state, 100), 1 + n_randint(state, 200));
+        arb_randtest(a, state, 1 + n_randint(state, 200), 4);
+
+        _fmpz_poly_evaluate_arb_horner(y1, p->coeffs, p->length, a, prec);
+        _fmpz_poly_evaluate_arb_rectangular(y2, p->coeffs, p->length, a, prec);
+        fmpz_poly_evaluate_arb(y3, p, a, prec);
+
+        if (!arb_overlaps(y1, y2) || !arb_overlaps(y1, y3))
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            printf("a = "); arb_printd(a, 10); printf("\n");
+            printf("horner = "); arb_printd(y1, 10); printf("\n");
+            printf("rectangular = "); arb_printd(y2, 10); printf("\n");
+            printf("evaluate = "); arb_printd(y3, 10); printf("\n");
+            abort();
+        }
+
+        /* at an exact point, the enclosures contain the exact value */
+        arf_set(x, arb_midref(a));
+        arb_set_arf(a, x);
+        arf_get_fmpq(q, x);
+        fmpz_poly_evaluate_fmpq(v, p, q);
+
+        _fmpz_poly_evaluate_arb_horner(y1, p->coeffs, p->length, a, prec);
+        _fmpz_poly_evaluate_arb_rectangular(y2, p->coeffs, p->length, a, prec);
+
+        if (!arb_contains_fmpq(y1, v) || !arb_contains_fmpq(y2, v))
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            printf("x = "); arf_printd(x, 10); printf("\n");
+            printf("horner = "); arb_printd(y1, 10); printf("\n");
+            printf("rectangular = "); arb_printd(y2, 10); printf("\n");
+            abort();
+        }
+
+        fmpz_poly_clear(p);
+        arb_clear(a);
+        arb_clear(y1);
+        arb_clear(y2);
+        arb_clear(y3);
+        arf_clear(x);
+        fmpq_clear(q);
+        fmpq_clear(v);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -0,0 +1,268 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <flint/fmpz.h>
+#include <flint/fmpq.h>
+#include <flint/fmpz_vec.h>
+#include <flint/fmpq_vec.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+/* Set p to a polynomial whose roots in [0,1) are the n distinct rationals */
+/* in roots. Some of the roots are dyadic.                                 */
+static void randtest_rational_roots(fmpz_poly_t p, fmpq * roots, slong n, flint_rand_t state)
+{
+    slong i, j;
+    fmpz_t den;
+    fmpz_poly_t q;
+
+    fmpz_init(den);
+    fmpz_poly_init(q);
+    fmpz_poly_one(p);
+
+    for (i = 0; i < n; i++)
+    {
+        do
+        {
+            if (n_randint(state, 2))
+                fmpz_set_ui(den, UWORD(1) << n_randint(state, 10));
+            else
+                fmpz_set_ui(den, 1 + n_randint(state, 1000));
+            fmpz_randm(fmpq_numref(roots + i), state, den);
+            fmpz_set(fmpq_denref(roots + i), den);
+            fmpq_canonicalise(roots + i);
+
+            for (j = 0; j < i; j++)
+                if (fmpq_equal(roots + i, roots + j))
+                    break;
+        } while (j < i);
+
+        fmpz_poly_set_coeff_fmpz(q, 1, fmpq_denref(roots + i));
+        fmpz_neg(fmpq_numref(roots + i), fmpq_numref(roots + i));
+        fmpz_poly_set_coeff_fmpz(q, 0, fmpq_numref(roots + i));
+        fmpz_neg(fmpq_numref(roots + i), fmpq_numref(roots + i));
+        fmpz_poly_mul(p, p, q);
+    }
+
+    /* a factor without real roots */
+    fmpz_poly_zero(q);
+    fmpz_poly_set_coeff_si(q, 2, 1);
+    fmpz_poly_set_coeff_si(q, 0, 1 + (slong)n_randint(state, 100));
+    if (n_randint(state, 2))
+        fmpz_poly_mul(p, p, q);
+
+    fmpz_poly_clear(q);
+    fmpz_clear(den);
+}
+
+/* Check that the arb variant produces the same output as exact VCA for */
+/* (pol, len) at precision prec.                                        */
+static void check_same_as_vca(const fmpz * pol, slong len, slong prec)
+{
+    fmpq * exact1;
+    fmpq * exact2;
+    fmpz * c1;
+    fmpz * c2;
+    slong * k1;
+    slong * k2;
+    slong i;
+    slong n_exact1 = 0, n_exact2 = 0, n_interval1 = 0, n_interval2 = 0;
+    fmpz_poly_t p;
+
+    fmpz_poly_init(p);
+    for (i = 0; i < len; i++)
+        fmpz_poly_set_coeff_fmpz(p, i, pol + i);
+
+    exact1 = _fmpq_vec_init(len);
+    exact2 = _fmpq_vec_init(len);
+    c1 = _fmpz_vec_init(len);
+    c2 = _fmpz_vec_init(len);
+    k1 = (slong *) flint_malloc(len * sizeof(slong));
+    k2 = (slong *) flint_malloc(len * sizeof(slong));
+
+    _fmpz_poly_isolate_real_roots_0_1_vca(exact1, &n_exact1, c1, k1, &n_interval1, p->coeffs, len);
+    _fmpz_poly_isolate_real_roots_0_1_arb(exact2, &n_exact2, c2, k2, &n_interval2, p->coeffs, len, prec);
+
+    if (n_exact1 != n_exact2 || n_interval1 != n_interval2)
+    {
+        printf("FAIL:\n");
+        printf("p = "); fmpz_poly_print(p); printf("\n");
+        flint_printf("exact arithmetic found %wd exact roots and %wd intervals but arb found %wd exact roots and %wd intervals\n", n_exact1, n_interval1, n_exact2, n_interval2);
+        abort();
+    }
+
+    for (i = 0; i < n_exact1; i++)
+    {
+        if (!fmpq_equal(exact1 + i, exact2 + i))
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("exact root %wd differs between exact arithmetic and arb\n", i);
+            abort();
+        }
+    }
+
+    for (i = 0; i < n_interval1; i++)
+    {
+        if (!fmpz_equal(c1 + i, c2 + i) || k1[i] != k2[i])
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("interval %wd differs between exact arithmetic and arb\n", i);
+            abort();
+        }
+    }
+
+    _fmpq_vec_clear(exact1, len);
+    _fmpq_vec_clear(exact2, len);
+    _fmpz_vec_clear(c1, len);
+    _fmpz_vec_clear(c2, len);
+    flint_free(k1);
+    flint_free(k2);
+    fmpz_poly_clear(p);
+}
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    /* the roots in [0,1) are isolated correctly, even at very low precision */
+    for (iter = 0; iter < 500; iter++)
+    {
+        fmpz_poly_t p;
+        fmpq * roots;
+        fmpq * exact;
+        fmpz * c;
+        slong * k;
+        slong n, n_exact, n_interval, i, j, len, found;
+        slong prec = 2 + (slong)n_randint(state, 100);
+        fmpq_t x, y;
+
+        n = 1 + (slong)n_randint(state, 20);
+        roots = _fmpq_vec_init(n);
+
+        fmpz_poly_init(p);
+        fmpq_init(x);
+        fmpq_init(y);
+
+        randtest_rational_roots(p, roots, n, state);
+
+        len = fmpz_poly_length(p);
+        exact = _fmpq_vec_init(len);
+        c = _fmpz_vec_init(len);
+        k = (slong *) flint_malloc(len * sizeof(slong));
+        n_exact = n_interval = 0;
+
+        _fmpz_poly_isolate_real_roots_0_1_arb(exact, &n_exact, c, k, &n_interval, p->coeffs, len, prec);
+
+        if (n_exact + n_interval != n)
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("found %wd exact roots and %wd intervals but expected %wd roots\n", n_exact, n_interval, n);
+            abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            found = 0;
+            for (j = 0; j < n_exact; j++)
+                if (fmpq_equal(exact + j, roots + i))
+                    found++;
+            for (j = 0; j < n_interval; j++)
+            {
+                fmpz_set(fmpq_numref(x), c + j);
+                fmpz_one(fmpq_denref(x));
+                fmpq_div_2exp(x, x, (ulong)-k[j]);
+                fmpz_add_ui(fmpq_numref(y), c + j, 1);
+                fmpz_one(fmpq_denref(y));
+                fmpq_div_2exp(y, y, (ulong)-k[j]);
+                if (fmpq_cmp(x, roots + i) < 0 && fmpq_cmp(roots + i, y) < 0)
+                    found++;
+            }
+
+            if (found != 1)
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("root "); fmpq_print(roots + i);
+                flint_printf(" has been found %wd times\n", found);
+                abort();
+            }
+        }
+
+        _fmpq_vec_clear(roots, n);
+        _fmpq_vec_clear(exact, len);
+        _fmpz_vec_clear(c, len);
+        flint_free(k);
+        fmpq_clear(x);
+        fmpq_clear(y);
+        fmpz_poly_clear(p);
+    }
+
+    /* the same output as with exact arithmetic */
+    for (iter = 0; iter < 200; iter++)
+    {
+        fmpz_poly_t p;
+        fmpq * roots;
+        slong k, n;
+
+        n = 1 + (slong)n_randint(state, 20);
+        roots = _fmpq_vec_init(n);
+
+        fmpz_poly_init(p);
+        if (n_randint(state, 2))
+            fmpz_poly_randtest_irreducible(p, state, 2 + (slong)n_randint(state, 150), 2 + n_randint(state, 200));
+        else
+            randtest_rational_roots(p, roots, n, state);
+
+        k = fmpz_poly_positive_root_upper_bound_2exp(p);
+        if (k != WORD_MIN)
+        {
+            _fmpz_poly_scale_2exp(p->coeffs, p->length, k);
+            check_same_as_vca(p->coeffs, p->length, 2 + (slong)n_randint(state, 200));
+        }
+
+        _fmpq_vec_clear(roots, n);
+        fmpz_poly_clear(p);
+    }
+
+    /* an exact root at 1/8 changes the polynomial of the nodes to its right */
+    {
+        const slong coeffs[] = {2535, -125294, 1651868, -7977838, 10997801, 9319613, -17595544, -7236224, -22007808, 70385664, -37748736};
+        const slong len = sizeof(coeffs) / sizeof(coeffs[0]);
+        fmpz * p = _fmpz_vec_init(len);
+        slong i, prec;
+
+        for (i = 0; i < len; i++)
+            fmpz_set_si(p + i, coeffs[i]);
+
+        for (prec = 2; prec <= 256; prec *= 2)
+            check_same_as_vca(p, len, prec);
+
+        _fmpz_vec_clear(p, len);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
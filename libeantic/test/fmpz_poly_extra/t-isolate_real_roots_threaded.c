@@ -0,0 +1,155 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <flint/fmpz.h>
+#include <flint/fmpq.h>
+#include <flint/fmpz_vec.h>
+#include <flint/fmpq_vec.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+/* Set p to a random squarefree polynomial with many real roots. If exact is
+ * set, some of them are dyadic. */
+static void randtest_real_rooted(fmpz_poly_t p, flint_rand_t state, int exact)
+{
+    slong i, n;
+    fmpz_poly_t q;
+    char used[201] = {0};
+
+    fmpz_poly_init(q);
+    fmpz_poly_one(p);
+
+    n = 1 + (slong)n_randint(state, 40);
+    for (i = 0; i < n; i++)
+    {
+        slong a = (slong)n_randint(state, 200) - 100;
+
+        /* (3x - a) has a root that is dyadic iff 3 divides a */
+        if (!exact && a % 3 == 0)
+            a++;
+
+        /* Root isolation requires the roots to be simple. */
+        if (used[a + 100])
+            continue;
+        used[a + 100] = 1;
+
+        fmpz_poly_set_coeff_si(q, 1, 3);
+        fmpz_poly_set_coeff_si(q, 0, -a);
+        fmpz_poly_mul(p, p, q);
+    }
+
+    fmpz_poly_clear(q);
+}
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_set_num_threads(4);
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        fmpz_poly_t p;
+        fmpq * exact1;
+        fmpq * exact2;
+        fmpz * c1;
+        fmpz * c2;
+        slong * k1;
+        slong * k2;
+        slong n_exact1, n_exact2, n_interval1, n_interval2, i, len;
+        slong thread_limit = 2 + (slong)n_randint(state, 7);
+
+        fmpz_poly_init(p);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                fmpz_poly_randtest_irreducible(p, state, 2 + (slong)n_randint(state, 80), 2 + n_randint(state, 20));
+                break;
+            case 1:
+                /* long enough that the sequential algorithm works with arb */
+                fmpz_poly_randtest_irreducible(p, state, 101 + (slong)n_randint(state, 50), 2 + n_randint(state, 20));
+                break;
+            case 2:
+                randtest_real_rooted(p, state, 0);
+                break;
+            default:
+                randtest_real_rooted(p, state, 1);
+                break;
+        }
+
+        len = fmpz_poly_length(p);
+
+        exact1 = _fmpq_vec_init(len);
+        exact2 = _fmpq_vec_init(len);
+        c1 = _fmpz_vec_init(len);
+        c2 = _fmpz_vec_init(len);
+        k1 = (slong *) flint_malloc(len * sizeof(slong));
+        k2 = (slong *) flint_malloc(len * sizeof(slong));
+
+        fmpz_poly_isolate_real_roots_threaded(exact1, &n_exact1, c1, k1, &n_interval1, p, 1);
+        fmpz_poly_isolate_real_roots_threaded(exact2, &n_exact2, c2, k2, &n_interval2, p, thread_limit);
+
+        if (n_exact1 != n_exact2 || n_interval1 != n_interval2 || !_fmpz_vec_equal(c1, c2, n_interval1))
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("sequential: %wd exact roots and %wd intervals\n", n_exact1, n_interval1);
+            flint_printf("threaded: %wd exact roots and %wd intervals\n", n_exact2, n_interval2);
+            abort();
+        }
+
+        for (i = 0; i < n_exact1; i++)
+        {
+            if (!fmpq_equal(exact1 + i, exact2 + i))
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                flint_printf("exact root %wd differs between sequential and threaded isolation\n", i);
+                abort();
+            }
+        }
+
+        for (i = 0; i < n_interval1; i++)
+        {
+            if (k1[i] != k2[i])
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                flint_printf("interval %wd differs between sequential and threaded isolation\n", i);
+                abort();
+            }
+        }
+
+        _fmpq_vec_clear(exact1, len);
+        _fmpq_vec_clear(exact2, len);
+        _fmpz_vec_clear(c1, len);
+        _fmpz_vec_clear(c2, len);
+        flint_free(k1);
+        flint_free(k2);
+        fmpz_poly_clear(p);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -0,0 +1,296 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <flint/fmpz.h>
+#include <flint/fmpq.h>
+#include <flint/fmpz_vec.h>
+#include <flint/fmpq_vec.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+/* Set p to a polynomial whose real roots are the n distinct rationals in */
+/* roots times a random polynomial without real roots. If dyadic is set,  */
+/* about half of the roots are dyadic.                                    */
+static void randtest_rational_roots(fmpz_poly_t p, fmpq * roots, slong n, flint_rand_t state, int dyadic)
+{
+    slong i, j;
+    fmpz_poly_t q;
+
+    fmpz_poly_init(q);
+    fmpz_poly_one(p);
+
+    for (i = 0; i < n; i++)
+    {
+        do
+        {
+            fmpq_randtest(roots + i, state, 1 + n_randint(state, 8));
+            if (dyadic && n_randint(state, 2))
+            {
+                fmpz_one(fmpq_denref(roots + i));
+                fmpz_mul_2exp(fmpq_denref(roots + i), fmpq_denref(roots + i), n_randint(state, 8));
+                fmpq_canonicalise(roots + i);
+            }
+            for (j = 0; j < i; j++)
+                if (fmpq_equal(roots + i, roots + j))
+                    break;
+        } while (j < i);
+
+        fmpz_poly_set_coeff_fmpz(q, 1, fmpq_denref(roots + i));
+        fmpz_neg(fmpq_numref(roots + i), fmpq_numref(roots + i));
+        fmpz_poly_set_coeff_fmpz(q, 0, fmpq_numref(roots + i));
+        fmpz_neg(fmpq_numref(roots + i), fmpq_numref(roots + i));
+        fmpz_poly_mul(p, p, q);
+    }
+
+    if (n_randint(state, 2))
+    {
+        /* x^2 + a with a > 0 */
+        fmpz_poly_zero(q);
+        fmpz_poly_set_coeff_si(q, 2, 1);
+        fmpz_poly_set_coeff_si(q, 0, 1 + (slong)n_randint(state, 100));
+        fmpz_poly_mul(p, p, q);
+    }
+
+    fmpz_poly_clear(q);
+}
+
+static int is_dyadic(const fmpq_t x)
+{
+    return fmpz_val2(fmpq_denref(x)) + 1 == fmpz_bits(fmpq_denref(x));
+}
+
+/* Set x and y to the endpoints of the interval (c 2^k, (c+1) 2^k). */
+static void interval_endpoints(fmpq_t x, fmpq_t y, const fmpz_t c, slong k)
+{
+    fmpz_set(fmpq_numref(x), c);
+    fmpz_one(fmpq_denref(x));
+    fmpq_add_si(y, x, 1);
+    if (k > 0)
+    {
+        fmpq_mul_2exp(x, x, (ulong)k);
+        fmpq_mul_2exp(y, y, (ulong)k);
+    }
+    else if (k < 0)
+    {
+        fmpq_div_2exp(x, x, (ulong)-k);
+        fmpq_div_2exp(y, y, (ulong)-k);
+    }
+}
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    /* the roots reported by VAS are exactly the known roots */
+    for (iter = 0; iter < 500; iter++)
+    {
+        fmpz_poly_t p;
+        fmpq * roots;
+        fmpq * exact;
+        fmpz * c;
+        slong * k;
+        slong n, n_exact, n_interval, i, j, len, found;
+        fmpq_t x, y;
+
+        n = 1 + (slong)n_randint(state, 20);
+        roots = _fmpq_vec_init(n);
+
+        fmpz_poly_init(p);
+        fmpq_init(x);
+        fmpq_init(y);
+
+        randtest_rational_roots(p, roots, n, state, 0);
+
+        len = fmpz_poly_length(p);
+        exact = _fmpq_vec_init(len);
+        c = _fmpz_vec_init(len);
+        k = (slong *) flint_malloc(len * sizeof(slong));
+
+        fmpz_poly_isolate_real_roots_set_method(FMPZ_POLY_ISOLATE_REAL_ROOTS_VAS);
+        fmpz_poly_isolate_real_roots(exact, &n_exact, c, k, &n_interval, p);
+
+        if (n_exact + n_interval != n)
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("found %wd exact roots and %wd intervals but expected %wd roots\n", n_exact, n_interval, n);
+            abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            found = 0;
+            for (j = 0; j < n_exact; j++)
+                if (fmpq_equal(exact + j, roots + i))
+                    found++;
+            for (j = 0; j < n_interval; j++)
+            {
+                interval_endpoints(x, y, c + j, k[j]);
+                if (fmpq_cmp(x, roots + i) < 0 && fmpq_cmp(roots + i, y) < 0)
+                    found++;
+            }
+
+            if (found != 1)
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("root "); fmpq_print(roots + i);
+                flint_printf(" has been found %wd times\n", found);
+                abort();
+            }
+        }
+
+        for (i = 1; i < n_exact; i++)
+        {
+            if (fmpq_cmp(exact + i - 1, exact + i) >= 0)
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("exact roots are not sorted\n");
+                abort();
+            }
+        }
+
+        _fmpq_vec_clear(roots, n);
+        _fmpq_vec_clear(exact, len);
+        _fmpz_vec_clear(c, len);
+        flint_free(k);
+        fmpq_clear(x);
+        fmpq_clear(y);
+        fmpz_poly_clear(p);
+    }
+
+    /* VAS and VCA find the same number of roots */
+    for (iter = 0; iter < 200; iter++)
+    {
+        fmpz_poly_t p;
+        slong n_exact1, n_exact2, n_interval1, n_interval2;
+
+        fmpz_poly_init(p);
+        fmpz_poly_randtest_irreducible(p, state, 2 + (slong)n_randint(state, 40), 2 + n_randint(state, 100));
+
+        fmpz_poly_isolate_real_roots_set_method(FMPZ_POLY_ISOLATE_REAL_ROOTS_VCA);
+        fmpz_poly_isolate_real_roots(NULL, &n_exact1, NULL, NULL, &n_interval1, p);
+        fmpz_poly_isolate_real_roots_set_method(FMPZ_POLY_ISOLATE_REAL_ROOTS_VAS);
+        fmpz_poly_isolate_real_roots(NULL, &n_exact2, NULL, NULL, &n_interval2, p);
+
+        if (n_exact1 + n_interval1 != n_exact2 + n_interval2)
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("VCA found %wd roots but VAS found %wd roots\n", n_exact1 + n_interval1, n_exact2 + n_interval2);
+            abort();
+        }
+
+        fmpz_poly_clear(p);
+    }
+
+    /* VAS reports all dyadic roots as exact roots, in particular the ones */
+    /* that VCA reports as exact roots, also if no intervals are requested */
+    for (iter = 0; iter < 500; iter++)
+    {
+        fmpz_poly_t p;
+        fmpq * roots;
+        fmpq * exact1;
+        fmpq * exact2;
+        fmpz * c;
+        slong * k;
+        slong n, n_exact1, n_exact2, n_exact3, n_interval1, n_interval2, n_interval3, n_dyadic, i, j, len;
+
+        n = 1 + (slong)n_randint(state, 20);
+        roots = _fmpq_vec_init(n);
+
+        fmpz_poly_init(p);
+
+        randtest_rational_roots(p, roots, n, state, 1);
+
+        len = fmpz_poly_length(p);
+        exact1 = _fmpq_vec_init(len);
+        exact2 = _fmpq_vec_init(len);
+        c = _fmpz_vec_init(len);
+        k = (slong *) flint_malloc(len * sizeof(slong));
+
+        fmpz_poly_isolate_real_roots_set_method(FMPZ_POLY_ISOLATE_REAL_ROOTS_VCA);
+        fmpz_poly_isolate_real_roots(exact1, &n_exact1, c, k, &n_interval1, p);
+        fmpz_poly_isolate_real_roots_set_method(FMPZ_POLY_ISOLATE_REAL_ROOTS_VAS);
+        fmpz_poly_isolate_real_roots(exact2, &n_exact2, c, k, &n_interval2, p);
+        fmpz_poly_isolate_real_roots(NULL, &n_exact3, NULL, NULL, &n_interval3, p);
+
+        if (n_exact1 + n_interval1 != n_exact2 + n_interval2)
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("VCA found %wd roots but VAS found %wd roots\n", n_exact1 + n_interval1, n_exact2 + n_interval2);
+            abort();
+        }
+
+        if (n_exact2 != n_exact3 || n_interval2 != n_interval3)
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("VAS found %wd exact roots and %wd intervals but %wd exact roots and %wd intervals without output arrays\n", n_exact2, n_interval2, n_exact3, n_interval3);
+            abort();
+        }
+
+        n_dyadic = 0;
+        for (i = 0; i < n; i++)
+            if (is_dyadic(roots + i))
+                n_dyadic++;
+
+        if (n_exact2 != n_dyadic)
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("VAS found %wd exact roots but there are %wd dyadic roots\n", n_exact2, n_dyadic);
+            abort();
+        }
+
+        for (i = 0; i < n_exact1; i++)
+        {
+            for (j = 0; j < n_exact2; j++)
+                if (fmpq_equal(exact1 + i, exact2 + j))
+                    break;
+
+            if (j == n_exact2)
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("exact root "); fmpq_print(exact1 + i);
+                printf(" of VCA not found by VAS\n");
+                abort();
+            }
+        }
+
+        _fmpq_vec_clear(roots, n);
+        _fmpq_vec_clear(exact1, len);
+        _fmpq_vec_clear(exact2, len);
+        _fmpz_vec_clear(c, len);
+        flint_free(k);
+        fmpz_poly_clear(p);
+    }
+
+    fmpz_poly_isolate_real_roots_set_method(FMPZ_POLY_ISOLATE_REAL_ROOTS_VCA);
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#include <flint/fmpq.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        slong i, j;
+        fmpz_poly_t p, dp, ap;
+        arb_t a, y, dy;
+        mag_t cond;
+        arf_t l, r, x;
+        fmpq_t q, v;
+        slong prec = 2 + (slong)n_randint(state, 300);
+
+        fmpz_poly_init(p);
+        fmpz_poly_init(dp);
+        fmpz_poly_init(ap);
+        arb_init(a);
+        arb_init(y);
+        arb_init(dy);
+        mag_init(cond);
+        arf_init(l);
+        arf_init(r);
+        arf_init(x);
+        fmpq_init(q);
+        fmpq_init(v);
+
+        fmpz_poly_randtest(p, state, 1 + (slong)n_randint(state, 50), 1 + n_randint(state, 100));
+        fmpz_poly_derivative(dp, p);
+        fmpz_poly_set(ap, p);
+        for (i = 0; i < ap->length; i++)
+            fmpz_abs(ap->coeffs + i, ap->coeffs + i);
+
+        arb_randtest(a, state, 1 + n_randint(state, 200), 4);
+
+        _fmpz_poly_newton_evaluate_arb(y, dy, cond, p->coeffs, p->length, a, prec);
+
+        /* y contains the value at the midpoint */
+        arf_get_fmpq(q, arb_midref(a));
+        fmpz_poly_evaluate_fmpq(v, p, q);
+        if (!arb_contains_fmpq(y, v))
+        {
+            printf("FAIL (value):\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            printf("a = "); arb_printd(a, 10); printf("\n");
+            printf("y = "); arb_printd(y, 10); printf("\n");
+            abort();
+        }
+
+        /* dy contains the derivative and cond bounds the condition number */
+        /* at points of a                                                    */
+        arb_get_interval_arf(l, r, a, ARF_PREC_EXACT);
+        for (j = 0; j <= 4; j++)
+        {
+            arf_sub(x, r, l, ARF_PREC_EXACT, ARF_RND_DOWN);
+            arf_mul_2exp_si(x, x, -2);
+            arf_mul_ui(x, x, (ulong)j, ARF_PREC_EXACT, ARF_RND_DOWN);
+            arf_add(x, x, l, ARF_PREC_EXACT, ARF_RND_DOWN);
+            arf_get_fmpq(q, x);
+
+            fmpz_poly_evaluate_fmpq(v, dp, q);
+            if (!arb_contains_fmpq(dy, v))
+            {
+                printf("FAIL (derivative):\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("a = "); arb_printd(a, 10); printf("\n");
+                printf("dy = "); arb_printd(dy, 10); printf("\n");
+                abort();
+            }
+
+            fmpq_abs(q, q);
+            fmpz_poly_evaluate_fmpq(v, ap, q);
+            arf_set_mag(x, cond);
+            arf_get_fmpq(q, x);
+            if (fmpq_cmp(v, q) > 0)
+            {
+                printf("FAIL (condition number):\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("a = "); arb_printd(a, 10); printf("\n");
+                printf("cond = "); mag_printd(cond, 10); printf("\n");
+                abort();
+            }
+        }
+
+        fmpz_poly_clear(p);
+        fmpz_poly_clear(dp);
+        fmpz_poly_clear(ap);
+        arb_clear(a);
+        arb_clear(y);
+        arb_clear(dy);
+        mag_clear(cond);
+        arf_clear(l);
+        arf_clear(r);
+        arf_clear(x);
+        fmpq_clear(q);
+        fmpq_clear(v);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#include <flint/fmpq.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/fmpz_poly_extra.h"
+
+/* Return the number of roots of the squarefree polynomial p in [a, b] */
+static slong num_roots_scaled(const fmpz_poly_t p, fmpq_t a, fmpq_t b)
+{
+    slong n;
+    fmpz_poly_t q;
+    fmpq_t y;
+
+    fmpq_init(y);
+    n = 0;
+    fmpz_poly_evaluate_fmpq(y, p, a);
+    n += fmpq_is_zero(y);
+    if (fmpq_equal(a, b))
+    {
+        fmpq_clear(y);
+        return n;
+    }
+    fmpz_poly_evaluate_fmpq(y, p, b);
+    n += fmpq_is_zero(y);
+    fmpq_clear(y);
+
+    fmpz_poly_init(q);
+    fmpz_poly_set(q, p);
+    _fmpz_poly_scale_0_1_fmpq(q->coeffs, q->length, a, b);
+    n += fmpz_poly_num_real_roots_0_1_vca(q);
+    fmpz_poly_clear(q);
+
+    return n;
+}
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        slong i, k1, k2;
+        fmpz_poly_t p, q, sqf;
+        fmpz_poly_sturm_t S;
+        fmpq_t a, b;
+
+        fmpz_poly_init(p);
+        fmpz_poly_init(q);
+        fmpz_poly_init(sqf);
+        fmpq_init(a);
+        fmpq_init(b);
+
+        do{
+            fmpz_poly_randtest_not_zero(p, state, 2 + (slong)n_randint(state, 20), 1 + n_randint(state, 50));
+        } while (fmpz_poly_degree(p) < 1);
+        if (n_randint(state, 2))
+        {
+            /* not squarefree */
+            fmpz_poly_randtest_not_zero(q, state, 1 + (slong)n_randint(state, 5), 1 + n_randint(state, 10));
+            fmpz_poly_mul(p, p, q);
+            fmpz_poly_mul(p, p, q);
+        }
+        fmpz_poly_squarefree_part(sqf, p);
+
+        fmpz_poly_sturm_init(S, p);
+
+        k1 = fmpz_poly_sturm_num_real_roots(S);
+        k2 = fmpz_poly_num_real_roots_vca(sqf);
+        if (k1 != k2)
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("(Sturm) k1 = %wd  (vca) k2 = %wd\n", k1, k2);
+            abort();
+        }
+
+        for (i = 0; i < 10; i++)
+        {
+            fmpq_randtest(a, state, 1 + n_randint(state, 10));
+            if (n_randint(state, 4))
+                fmpq_randtest(b, state, 1 + n_randint(state, 10));
+            else
+                fmpq_set(b, a);
+            if (fmpq_cmp(a, b) > 0)
+                fmpq_swap(a, b);
+
+            k1 = fmpz_poly_sturm_num_roots_fmpq(S, a, b);
+            k2 = num_roots_scaled(sqf, a, b);
+            if (k1 != k2)
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("a = "); fmpq_print(a); printf("\n");
+                printf("b = "); fmpq_print(b); printf("\n");
+                flint_printf("(Sturm) k1 = %wd  (vca) k2 = %wd\n", k1, k2);
+                abort();
+            }
+        }
+
+        for (i = 0; i < 10; i++)
+        {
+            arb_t x;
+            arf_t l, r;
+            slong prec = 2 + (slong)n_randint(state, 100);
+
+            arb_init(x);
+            arf_init(l);
+            arf_init(r);
+
+            arb_randtest(x, state, 1 + n_randint(state, 100), 4);
+            arb_get_interval_arf(l, r, x, ARF_PREC_EXACT);
+            arf_get_fmpq(a, l);
+            arf_get_fmpq(b, r);
+
+            k1 = fmpz_poly_sturm_num_roots_arb(S, x, prec);
+            k2 = fmpz_poly_sturm_num_roots_fmpq(S, a, b);
+            if (k1 != k2)
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("x = "); arb_printd(x, 10); printf("\n");
+                flint_printf("(arb) k1 = %wd  (fmpq) k2 = %wd\n", k1, k2);
+                abort();
+            }
+
+            arb_clear(x);
+            arf_clear(l);
+            arf_clear(r);
+        }
+
+        fmpz_poly_sturm_clear(S);
+        fmpz_poly_clear(p);
+        fmpz_poly_clear(q);
+        fmpz_poly_clear(sqf);
+        fmpq_clear(a);
+        fmpq_clear(b);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
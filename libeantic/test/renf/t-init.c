@@ -73,7 +73,7 @@ static void randomized_embedding(arb_t res, double emb, double rad1, double rad2
 
 static void check_init(fmpq_poly_t p, double demb, double rad1, double rad2, slong iter, flint_rand_t state)
 {
-    renf_t nf;
+    renf_t nf, copy;
     arb_t emb;
     slong prec, i;
 
@@ -85,7 +85,20 @@ static void check_init(fmpq_poly_t p, double demb, double rad1, double rad2, slo
 
         renf_init(nf, p, emb, prec);
         check_renf(nf);
+
+        /* copies share the number field and outlive the original */
+        renf_init_set(copy, nf);
+        if (copy->nf != nf->nf || copy->der != nf->der)
+        {
+            printf("FAIL:\n");
+            printf("copy does not share the number field\n");
+            fflush(stdout);
+            abort();
+        }
         renf_clear(nf);
+        renf_refine_embedding(copy, 2 * prec);
+        check_renf(copy);
+        renf_clear(copy);
     }
     arb_clear(emb);
 }
@@ -0,0 +1,137 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf.h"
+#include "../../e-antic/renf_elem.h"
+#include "../../e-antic/fmpq_poly_extra.h"
+
+int main(void)
+{
+    renf_t nf;
+    renf_elem_t a, b;
+    fmpq_poly_t p;
+    fmpq_t eps;
+    arb_t emb;
+    ulong predicates, escalations;
+    slong i, prec;
+
+    FLINT_TEST_INIT(state);
+
+    fmpq_poly_init(p);
+    fmpq_poly_set_str_pretty(p, "x^3 - 2", "x");
+    arb_init(emb);
+    arb_set_d(emb, 1.26);
+    mag_set_d(arb_radref(emb), 0.1);
+    renf_init(nf, p, emb, 16);
+
+    renf_elem_init(a, nf);
+    renf_elem_init(b, nf);
+    fmpq_init(eps);
+    fmpq_set_si(eps, 1, 1);
+    fmpz_mul_2exp(fmpq_denref(eps), fmpq_denref(eps), 100);
+    renf_elem_gen(a, nf);
+
+    /* without a range, the precision does not change and nothing is recorded */
+    for (i = 0; i < 1000; i++)
+    {
+        renf_elem_add_fmpq(b, a, eps, nf);
+        if (renf_elem_cmp(a, b, nf) != -1)
+        {
+            printf("FAIL:\n");
+            printf("wrong comparison\n");
+            fflush(stdout);
+            abort();
+        }
+    }
+
+    renf_get_predicate_statistics(&predicates, &escalations, nf);
+    if (nf->prec != 16 || predicates != 0 || escalations != 0)
+    {
+        printf("FAIL:\n");
+        printf("fixed precision changed or statistics wrong\n");
+        printf("prec = %ld, predicates = %lu, escalations = %lu\n", (long) nf->prec, (unsigned long) predicates, (unsigned long) escalations);
+        fflush(stdout);
+        abort();
+    }
+
+    /* comparisons that need more than 100 bits of precision raise the precision */
+    renf_set_prec_range(nf, 16, 4096);
+    for (i = 0; i < 2000; i++)
+    {
+        renf_elem_add_fmpq(b, a, eps, nf);
+        if (renf_elem_cmp(a, b, nf) != -1)
+        {
+            printf("FAIL:\n");
+            printf("wrong comparison\n");
+            fflush(stdout);
+            abort();
+        }
+    }
+
+    renf_get_predicate_statistics(&predicates, &escalations, nf);
+    if (predicates < 2000 || escalations == 0)
+    {
+        printf("FAIL:\n");
+        printf("predicates not recorded with a range of precisions\n");
+        printf("predicates = %lu, escalations = %lu\n", (unsigned long) predicates, (unsigned long) escalations);
+        fflush(stdout);
+        abort();
+    }
+
+    if (nf->prec < 100 || nf->prec > 4096)
+    {
+        printf("FAIL:\n");
+        printf("precision was not raised, prec = %ld\n", (long) nf->prec);
+        fflush(stdout);
+        abort();
+    }
+
+    /* easy predicates lower the precision again */
+    prec = nf->prec;
+    for (i = 0; i < 100 * 128; i++)
+    {
+        if (renf_elem_sgn(a, nf) != 1)
+        {
+            printf("FAIL:\n");
+            printf("wrong sign\n");
+            fflush(stdout);
+            abort();
+        }
+    }
+
+    if (nf->prec >= prec)
+    {
+        printf("FAIL:\n");
+        printf("precision was not lowered, prec = %ld\n", (long) nf->prec);
+        fflush(stdout);
+        abort();
+    }
+
+    renf_elem_clear(a, nf);
+    renf_elem_clear(b, nf);
+    fmpq_clear(eps);
+    arb_clear(emb);
+    fmpq_poly_clear(p);
+    renf_clear(nf);
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -9,6 +9,9 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <flint/fmpq_poly.h>
+#include <flint/fmpz_poly_factor.h>
+
 #include "../../e-antic/config.h"
 
 #include "../../e-antic/renf.h"
@@ -35,10 +38,163 @@ int main(void)
 
         n  = renf_set_embeddings_fmpz_poly(nfemb, p, MAX_DEGREE, 64);
 
+        if (n != fmpz_poly_num_real_roots_vca(p))
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            flint_printf("got %wd embeddings\n", n);
+            abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            arb_t y;
+
+            if (fmpq_poly_degree(nfemb[i].nf->pol) != fmpz_poly_degree(p))
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("the defining polynomial "); fmpq_poly_print(nfemb[i].nf->pol);
+                printf(" has the wrong degree\n");
+                abort();
+            }
+
+            arb_init(y);
+            fmpz_poly_evaluate_arb(y, p, nfemb[i].emb, 64);
+            if (!arb_contains_zero(y))
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("the embedding "); arb_printd(nfemb[i].emb, 10);
+                printf(" does not contain a root of p\n");
+                abort();
+            }
+            arb_clear(y);
+        }
+
         fmpz_poly_clear(p);
         for (i = 0; i < n; i++) renf_clear(nfemb + i);
     }
 
+    /* reducible polynomials with rational roots */
+    for (iter = 0; iter < 100; iter++)
+    {
+        slong i, j, n, m;
+        int rational;
+        fmpz_poly_t p, q, r;
+        fmpz_poly_factor_t fac;
+        fmpq_t root;
+        arb_t y;
+        renf nfemb[3 * MAX_DEGREE];
+
+        fmpz_poly_init(p);
+        fmpz_poly_init(q);
+        fmpz_poly_init(r);
+        fmpz_poly_factor_init(fac);
+        fmpq_init(root);
+        arb_init(y);
+
+        flint_set_num_threads(1 + (slong) n_randint(state, 4));
+
+        do{
+            fmpz_poly_randtest_irreducible(p, state, MAX_DEGREE + 1, 20);
+        }while(fmpz_poly_degree(p) < 1);
+        fmpz_poly_randtest(q, state, 1 + (slong) n_randint(state, MAX_DEGREE), 10);
+        if (fmpz_poly_is_zero(q))
+            fmpz_poly_one(q);
+        fmpz_poly_set_coeff_si(r, 1, 1 + (slong) n_randint(state, 5));
+        fmpz_poly_set_coeff_si(r, 0, (slong) n_randint(state, 11) - 5);
+
+        fmpz_poly_mul(p, p, q);
+        fmpz_poly_mul(p, p, r);
+        fmpz_poly_mul(p, p, r);
+
+        fmpz_poly_factor(fac, p);
+
+        /* the root of r */
+        fmpz_neg(fmpq_numref(root), r->coeffs);
+        fmpz_set(fmpq_denref(root), r->coeffs + 1);
+        fmpq_canonicalise(root);
+
+        m = 1 + (slong) n_randint(state, 3 * MAX_DEGREE);
+        n = renf_set_embeddings_fmpz_poly(nfemb, p, m, 64);
+
+        if (n < 1)
+        {
+            printf("FAIL:\n");
+            printf("the rational root of p = "); fmpz_poly_print(p);
+            printf(" has not been found\n");
+            abort();
+        }
+
+        rational = 0;
+        for (i = 0; i < FLINT_MIN(n, m); i++)
+        {
+            fmpq_poly_t g;
+
+            /* the defining polynomial is the irreducible factor of p */
+            /* whose root is the embedding                            */
+            fmpq_poly_init(g);
+            for (j = 0; j < fac->num; j++)
+            {
+                if (fmpz_poly_degree(fac->p + j) != fmpq_poly_degree(nfemb[i].nf->pol))
+                    continue;
+
+                fmpq_poly_set_fmpz_poly(g, fac->p + j);
+                fmpq_poly_rem(g, g, nfemb[i].nf->pol);
+                if (fmpq_poly_is_zero(g))
+                    break;
+            }
+            fmpq_poly_clear(g);
+
+            if (j == fac->num)
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("the defining polynomial "); fmpq_poly_print(nfemb[i].nf->pol);
+                printf(" is not an irreducible factor of p\n");
+                abort();
+            }
+
+            fmpz_poly_evaluate_arb(y, fac->p + j, nfemb[i].emb, 64);
+            if (!arb_contains_zero(y))
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("the embedding "); arb_printd(nfemb[i].emb, 10);
+                printf(" does not contain a root of "); fmpq_poly_print(nfemb[i].nf->pol); printf("\n");
+                abort();
+            }
+
+            if (fmpq_poly_degree(nfemb[i].nf->pol) == 1 && arb_contains_fmpq(nfemb[i].emb, root))
+                rational = 1;
+
+            if (i > 0 && !arb_lt(nfemb[i - 1].emb, nfemb[i].emb))
+            {
+                printf("FAIL:\n");
+                printf("p = "); fmpz_poly_print(p); printf("\n");
+                printf("the embeddings are not increasing\n");
+                abort();
+            }
+        }
+
+        if (m >= n && !rational)
+        {
+            printf("FAIL:\n");
+            printf("p = "); fmpz_poly_print(p); printf("\n");
+            printf("no field of degree one embedded as "); fmpq_print(root); printf("\n");
+            abort();
+        }
+
+        for (i = 0; i < FLINT_MIN(n, m); i++) renf_clear(nfemb + i);
+        fmpz_poly_clear(p);
+        fmpz_poly_clear(q);
+        fmpz_poly_clear(r);
+        fmpz_poly_factor_clear(fac);
+        fmpq_clear(root);
+        arb_clear(y);
+    }
+
 #ifdef FLINT_TEST_CLEAR
     FLINT_TEST_CLEAR(state)
 #else
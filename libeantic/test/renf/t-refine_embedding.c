@@ -0,0 +1,80 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf.h"
+#include "../../e-antic/fmpq_poly_extra.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        renf_t nf;
+        arb_t emb, b;
+        slong prec;
+
+        renf_randtest(nf, state, 2 + n_randint(state, 20), 64, 10 + n_randint(state, 100));
+
+        /* refine far beyond the initial precision as happens on near-ties */
+        prec = 64 + (slong)n_randint(state, iter % 10 == 0 ? 12000 : 1000);
+
+        arb_init(emb);
+        arb_init(b);
+        arb_set(emb, nf->emb);
+
+        renf_refine_embedding(nf, prec);
+
+        if (arb_rel_accuracy_bits(nf->emb) < prec)
+        {
+            printf("FAIL:\n");
+            printf("pol = "); fmpq_poly_print_pretty(nf->nf->pol, "x"); printf("\n");
+            flint_printf("requested %wd bits but got %wd bits\n", prec, arb_rel_accuracy_bits(nf->emb));
+            abort();
+        }
+
+        if (!arb_contains(emb, nf->emb))
+        {
+            printf("FAIL:\n");
+            printf("pol = "); fmpq_poly_print_pretty(nf->nf->pol, "x"); printf("\n");
+            printf("refined embedding is not contained in the original embedding\n");
+            abort();
+        }
+
+        fmpq_poly_evaluate_arb(b, nf->nf->pol, nf->emb, prec + 64);
+        if (!arb_contains_zero(b))
+        {
+            printf("FAIL:\n");
+            printf("pol = "); fmpq_poly_print_pretty(nf->nf->pol, "x"); printf("\n");
+            printf("refined embedding does not contain a root\n");
+            abort();
+        }
+
+        arb_clear(emb);
+        arb_clear(b);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf.h"
+#include "../../e-antic/renf_elem.h"
+#include "../../e-antic/fmpq_poly_extra.h"
+
+static int is_zero(const renf_statistics * statistics)
+{
+    renf_statistics zero;
+    memset(&zero, 0, sizeof(renf_statistics));
+    return memcmp(statistics, &zero, sizeof(renf_statistics)) == 0;
+}
+
+int main(void)
+{
+    renf_t nf;
+    renf_elem_t a, b;
+    renf_statistics statistics, global;
+    fmpq_poly_t p;
+    fmpq_t eps;
+    arb_t emb;
+
+    FLINT_TEST_INIT(state);
+
+    fmpq_poly_init(p);
+    fmpq_poly_set_str_pretty(p, "x^3 - 2", "x");
+    arb_init(emb);
+    arb_set_d(emb, 1.26);
+    mag_set_d(arb_radref(emb), 0.1);
+    renf_init(nf, p, emb, 32);
+
+    renf_elem_init(a, nf);
+    renf_elem_init(b, nf);
+    fmpq_init(eps);
+    fmpq_set_si(eps, 1, 1);
+    fmpz_mul_2exp(fmpq_denref(eps), fmpq_denref(eps), 200);
+
+    /* a comparison that needs to compute the difference exactly */
+    renf_reset_statistics(nf);
+    renf_reset_global_statistics();
+    renf_elem_gen(a, nf);
+    renf_elem_add_fmpq(b, a, eps, nf);
+    if (renf_elem_cmp(a, b, nf) != -1)
+    {
+        printf("FAIL:\n");
+        printf("wrong comparison\n");
+        fflush(stdout);
+        abort();
+    }
+    renf_refine_embedding(nf, 256);
+
+    renf_get_statistics(&statistics, nf);
+    renf_get_global_statistics(&global);
+
+    if (renf_statistics_enabled())
+    {
+        if (statistics.escalations == 0 || statistics.cmp_differences != 1 || statistics.refinements != 1 || statistics.max_prec == 0 || statistics.coercions != 0)
+        {
+            printf("FAIL:\n");
+            printf("unexpected statistics\n");
+            printf("refinements = %lu, escalations = %lu, max_prec = %lu, cmp_differences = %lu\n",
+                (unsigned long) statistics.refinements,
+                (unsigned long) statistics.escalations,
+                (unsigned long) statistics.max_prec,
+                (unsigned long) statistics.cmp_differences);
+            fflush(stdout);
+            abort();
+        }
+
+        if (global.escalations < statistics.escalations || global.cmp_differences < statistics.cmp_differences)
+        {
+            printf("FAIL:\n");
+            printf("global statistics do not include the field\n");
+            fflush(stdout);
+            abort();
+        }
+    }
+    else if (!is_zero(&statistics) || !is_zero(&global))
+    {
+        printf("FAIL:\n");
+        printf("statistics maintained although disabled\n");
+        fflush(stdout);
+        abort();
+    }
+
+    renf_reset_statistics(nf);
+    renf_get_statistics(&statistics, nf);
+    if (!is_zero(&statistics))
+    {
+        printf("FAIL:\n");
+        printf("statistics not reset\n");
+        fflush(stdout);
+        abort();
+    }
+
+    renf_elem_clear(a, nf);
+    renf_elem_clear(b, nf);
+    fmpq_clear(eps);
+    arb_clear(emb);
+    fmpq_poly_clear(p);
+    renf_clear(nf);
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
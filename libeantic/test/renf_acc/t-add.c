@@ -0,0 +1,138 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_acc.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        renf_t nf;
+        renf_acc_t acc;
+        renf_elem_t a, b, sum, res;
+        fmpq_t c;
+        fmpz_t z;
+        slong i, n;
+
+        renf_randtest(nf, state,
+                2 + (slong)n_randint(state, 6),  /* length */
+                8 + (slong)n_randint(state, 64), /* prec */
+                10 + n_randint(state, 5)         /* bits */
+                );
+
+        renf_acc_init(acc, nf);
+        renf_elem_init(a, nf);
+        renf_elem_init(b, nf);
+        renf_elem_init(sum, nf);
+        renf_elem_init(res, nf);
+        fmpq_init(c);
+        fmpz_init(z);
+
+        renf_elem_zero(sum, nf);
+
+        n = (slong)n_randint(state, 100);
+
+        for (i = 0; i < n; i++)
+        {
+            renf_elem_randtest(a, state, 10 + n_randint(state, 30), nf);
+
+            switch (n_randint(state, 5))
+            {
+                case 0:
+                    renf_acc_add(acc, a, nf);
+                    renf_elem_add(sum, sum, a, nf);
+                    break;
+                case 1:
+                    renf_acc_sub(acc, a, nf);
+                    renf_elem_sub(sum, sum, a, nf);
+                    break;
+                case 2:
+                    renf_elem_randtest(b, state, 10 + n_randint(state, 30), nf);
+                    renf_acc_addmul(acc, a, b, nf);
+                    renf_elem_addmul(sum, a, b, nf);
+                    break;
+                case 3:
+                    fmpz_randtest(z, state, 20);
+                    renf_acc_add_fmpz(acc, z, nf);
+                    renf_elem_add_fmpz(sum, sum, z, nf);
+                    break;
+                default:
+                    fmpq_randtest(c, state, 20);
+                    renf_acc_add_fmpq(acc, c, nf);
+                    renf_elem_add_fmpq(sum, sum, c, nf);
+                    break;
+            }
+        }
+
+        renf_acc_finish(res, acc, nf);
+
+        if (!renf_elem_equal(res, sum, nf))
+        {
+            printf("FAIL:\n");
+            printf("sum = "); renf_elem_print_pretty(sum, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("accumulated = "); renf_elem_print_pretty(res, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            abort();
+        }
+
+        renf_elem_check_embedding(res, nf, 64);
+
+        /* The accumulator can be used after finishing. */
+        renf_acc_sub(acc, res, nf);
+        renf_acc_finish(res, acc, nf);
+
+        if (!renf_elem_is_zero(res, nf))
+        {
+            printf("FAIL:\n");
+            printf("accumulator is not zero after subtracting its value\n");
+            abort();
+        }
+
+        /* Integral terms are scaled to the denominator of the accumulator. */
+        renf_acc_zero(acc);
+        fmpq_set_si(c, 1, 3);
+        renf_acc_add_fmpq(acc, c, nf);
+        fmpz_one(z);
+        renf_acc_add_fmpz(acc, z, nf);
+        renf_acc_finish(res, acc, nf);
+
+        fmpq_set_si(c, 4, 3);
+        if (!renf_elem_equal_fmpq(res, c, nf))
+        {
+            printf("FAIL:\n");
+            printf("1/3 + 1 = "); renf_elem_print_pretty(res, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            abort();
+        }
+
+        renf_acc_clear(acc);
+        renf_elem_clear(a, nf);
+        renf_elem_clear(b, nf);
+        renf_elem_clear(sum, nf);
+        renf_elem_clear(res, nf);
+        fmpq_clear(c);
+        fmpz_clear(z);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
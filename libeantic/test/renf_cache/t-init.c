@@ -0,0 +1,180 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_cache.h"
+#include "../../e-antic/fmpq_poly_extra.h"
+
+#define PATH "t-init.renf_cache"
+#define N 3
+
+static const char * polynomials[N] = {"x^2-2", "x^30-3000*x-1", "x^4-100*x^3+50*x^2-20*x+1"};
+static const char * embeddings[N] = {"1.41 +/- 0.1", "1.3 +/- 0.1", "99.5 +/- 1"};
+
+static void check_fields(renf_t * nf, int cached, slong prec)
+{
+    renf_cache * cache = renf_get_cache();
+    fmpq_poly_t p;
+    arb_t emb, res;
+    int i;
+
+    fmpq_poly_init(p);
+    arb_init(emb);
+    arb_init(res);
+
+    for (i = 0; i < N; i++)
+    {
+        renf_t K;
+
+        fmpq_poly_set_str_pretty(p, polynomials[i], "x");
+        arb_set_str(emb, embeddings[i], prec);
+
+        if (renf_cache_get(res, cache, p, emb, prec) != cached)
+        {
+            printf("FAIL:\n");
+            printf("unexpected cache %s for %s\n", cached ? "miss" : "hit", polynomials[i]);
+            fflush(stdout);
+            abort();
+        }
+
+        if (renf_cache_get(res, cache, p, emb, 2 * prec))
+        {
+            printf("FAIL:\n");
+            printf("cache hit for higher precision for %s\n", polynomials[i]);
+            fflush(stdout);
+            abort();
+        }
+
+        renf_init(K, p, emb, prec);
+
+        if (cached && !arb_equal(K->emb, nf[i]->emb))
+        {
+            printf("FAIL:\n");
+            printf("cached embedding differs for %s\n", polynomials[i]);
+            printf("got "); arb_printd(K->emb, 20); printf("\n");
+            printf("expected "); arb_printd(nf[i]->emb, 20); printf("\n");
+            fflush(stdout);
+            abort();
+        }
+
+        renf_clear(K);
+    }
+
+    fmpq_poly_clear(p);
+    arb_clear(emb);
+    arb_clear(res);
+}
+
+static void check_init(const char * path, slong limit, int valid, slong length)
+{
+    renf_cache_t cache;
+
+    if (renf_cache_init(cache, path, limit) != valid || cache->length != length)
+    {
+        printf("FAIL:\n");
+        printf("expected valid = %d and length = %ld but got length %ld\n", valid, (long) length, (long) cache->length);
+        fflush(stdout);
+        abort();
+    }
+
+    renf_cache_clear(cache);
+}
+
+int main(void)
+{
+    renf_t nf[N];
+    renf_cache_t cache;
+    fmpq_poly_t p;
+    arb_t emb;
+    FILE * file;
+    long size;
+    int i, c;
+    const slong prec = 128;
+
+    FLINT_TEST_INIT(state);
+
+    remove(PATH);
+
+    fmpq_poly_init(p);
+    arb_init(emb);
+
+    /* create fields without a cache for reference */
+    for (i = 0; i < N; i++)
+    {
+        fmpq_poly_set_str_pretty(p, polynomials[i], "x");
+        arb_set_str(emb, embeddings[i], prec);
+        renf_init(nf[i], p, emb, prec);
+    }
+
+    /* a missing file gives an empty cache that is populated by renf_init() */
+    check_init(PATH, 1 << 20, 0, 0);
+    renf_cache_init(cache, PATH, 1 << 20);
+    renf_set_cache(cache);
+    check_fields(nf, 0, prec);
+    check_fields(nf, 1, prec);
+
+    if (!renf_cache_write(cache))
+    {
+        printf("FAIL:\n");
+        printf("could not write cache\n");
+        fflush(stdout);
+        abort();
+    }
+
+    renf_set_cache(NULL);
+    renf_cache_clear(cache);
+
+    /* the cache can be read back */
+    check_init(PATH, 1 << 20, 1, N);
+    renf_cache_init(cache, PATH, 1 << 20);
+    renf_set_cache(cache);
+    check_fields(nf, 1, prec);
+    renf_set_cache(NULL);
+    renf_cache_clear(cache);
+
+    /* the size limit is respected and includes header and checksum */
+    file = fopen(PATH, "rb");
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fclose(file);
+    check_init(PATH, size, 1, N);
+    check_init(PATH, size - 1, 1, N - 1);
+    check_init(PATH, 1, 1, 0);
+
+    /* damaged files are detected */
+    file = fopen(PATH, "r+b");
+    fseek(file, 30, SEEK_SET);
+    c = fgetc(file);
+    fseek(file, 30, SEEK_SET);
+    fputc(c == '1' ? '2' : '1', file);
+    fclose(file);
+    check_init(PATH, 1 << 20, 0, 0);
+
+    remove(PATH);
+
+    for (i = 0; i < N; i++)
+        renf_clear(nf[i]);
+    fmpq_poly_clear(p);
+    arb_clear(emb);
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf.h"
+#include "../../e-antic/renf_elem.h"
+#include "../../e-antic/renf_hom.h"
+#include "../../e-antic/fmpq_poly_extra.h"
+
+static void init_field(renf_t nf, const char * pol, double emb, double rad)
+{
+    fmpq_poly_t p;
+    arb_t e;
+
+    fmpq_poly_init(p);
+    fmpq_poly_set_str_pretty(p, pol, "x");
+    arb_init(e);
+    arb_set_d(e, emb);
+    mag_set_d(arb_radref(e), rad);
+    renf_init(nf, p, e, 64);
+    fmpq_poly_clear(p);
+    arb_clear(e);
+}
+
+int main(void)
+{
+    renf_t K, L;
+    renf_elem_t image, a, b, c, fa, fb, fc;
+    renf_hom_t f;
+    int iter;
+
+    FLINT_TEST_INIT(state);
+
+    /* Q(sqrt(2)) embeds into Q(2^(1/4)) by sending sqrt(2) to (2^(1/4))^2 */
+    init_field(K, "x^2 - 2", 1.4, 0.1);
+    init_field(L, "x^4 - 2", 1.19, 0.01);
+
+    renf_elem_init(image, L);
+    renf_elem_init(a, K);
+    renf_elem_init(b, K);
+    renf_elem_init(c, K);
+    renf_elem_init(fa, L);
+    renf_elem_init(fb, L);
+    renf_elem_init(fc, L);
+
+    /* the generator of L is not a square root of 2 */
+    renf_elem_gen(image, L);
+    if (renf_hom_init(f, K, image, L))
+    {
+        printf("FAIL:\n");
+        printf("accepted an element that is not a root\n");
+        fflush(stdout);
+        abort();
+    }
+
+    /* -(2^(1/4))^2 is the wrong square root of 2 */
+    renf_elem_pow(image, image, 2, L);
+    renf_elem_neg(image, image, L);
+    if (renf_hom_init(f, K, image, L))
+    {
+        printf("FAIL:\n");
+        printf("accepted a root with the wrong embedding\n");
+        fflush(stdout);
+        abort();
+    }
+
+    renf_elem_neg(image, image, L);
+    if (!renf_hom_init(f, K, image, L))
+    {
+        printf("FAIL:\n");
+        printf("rejected a valid embedding\n");
+        fflush(stdout);
+        abort();
+    }
+
+    renf_elem_gen(a, K);
+    renf_hom_apply(fa, a, f, K, L);
+    if (!renf_elem_equal(fa, image, L))
+    {
+        printf("FAIL:\n");
+        printf("generator not mapped to its image\n");
+        fflush(stdout);
+        abort();
+    }
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        renf_elem_randtest(a, state, 10 + n_randint(state, 30), K);
+        renf_elem_randtest(b, state, 10 + n_randint(state, 30), K);
+
+        renf_hom_apply(fa, a, f, K, L);
+        renf_hom_apply(fb, b, f, K, L);
+
+        if (!arb_overlaps(a->emb, fa->emb))
+        {
+            printf("FAIL:\n");
+            printf("embedding does not preserve the real value\n");
+            fflush(stdout);
+            abort();
+        }
+
+        renf_elem_mul(c, a, b, K);
+        renf_hom_apply(fc, c, f, K, L);
+        renf_elem_mul(fa, fa, fb, L);
+        if (!renf_elem_equal(fa, fc, L))
+        {
+            printf("FAIL:\n");
+            printf("embedding is not multiplicative\n");
+            fflush(stdout);
+            abort();
+        }
+
+        renf_elem_add(c, a, b, K);
+        renf_hom_apply(fc, c, f, K, L);
+        renf_hom_apply(fa, a, f, K, L);
+        renf_elem_add(fa, fa, fb, L);
+        if (!renf_elem_equal(fa, fc, L))
+        {
+            printf("FAIL:\n");
+            printf("embedding is not additive\n");
+            fflush(stdout);
+            abort();
+        }
+    }
+
+    renf_hom_clear(f);
+
+    renf_elem_clear(image, L);
+    renf_elem_clear(a, K);
+    renf_elem_clear(b, K);
+    renf_elem_clear(c, K);
+    renf_elem_clear(fa, L);
+    renf_elem_clear(fb, L);
+    renf_elem_clear(fc, L);
+    renf_clear(K);
+    renf_clear(L);
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
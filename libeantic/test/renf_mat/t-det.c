@@ -0,0 +1,99 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 50; iter++)
+    {
+        renf_t nf;
+        renf_mat_t A, B, AB;
+        renf_elem_t a, b, ab;
+        slong n;
+
+        renf_randtest(nf, state,
+                2 + (slong)n_randint(state, 6),  /* length */
+                8 + (slong)n_randint(state, 64), /* prec */
+                10 + n_randint(state, 5)         /* bits */
+                );
+
+        n = (slong)n_randint(state, 6);
+
+        renf_mat_init(A, n, n, nf);
+        renf_mat_init(B, n, n, nf);
+        renf_mat_init(AB, n, n, nf);
+        renf_elem_init(a, nf);
+        renf_elem_init(b, nf);
+        renf_elem_init(ab, nf);
+
+        renf_mat_randtest(A, state, 5 + n_randint(state, 10), nf);
+        renf_mat_randtest(B, state, 5 + n_randint(state, 10), nf);
+
+        /* Make A singular every now and then. */
+        if (n > 1 && n_randint(state, 4) == 0)
+        {
+            slong j;
+            for (j = 0; j < n; j++)
+                renf_elem_set(renf_mat_entry(A, n - 1, j), renf_mat_entry(A, 0, j), nf);
+        }
+
+        renf_mat_mul(AB, A, B, nf);
+
+        renf_mat_det(a, A, nf);
+        renf_mat_det(b, B, nf);
+        renf_mat_det(ab, AB, nf);
+
+        renf_elem_mul(a, a, b, nf);
+
+        if (!renf_elem_equal(a, ab, nf))
+        {
+            printf("FAIL:\n");
+            printf("A = \n"); renf_mat_print_pretty(A, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("B = \n"); renf_mat_print_pretty(B, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("det(A) det(B) != det(AB)\n");
+            abort();
+        }
+
+        if (renf_elem_is_zero(ab, nf) != (renf_mat_rank(AB, nf) < n))
+        {
+            printf("FAIL:\n");
+            printf("A = \n"); renf_mat_print_pretty(AB, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("determinant and rank are inconsistent\n");
+            abort();
+        }
+
+        renf_elem_check_embedding(ab, nf, 64);
+
+        renf_mat_clear(A, nf);
+        renf_mat_clear(B, nf);
+        renf_mat_clear(AB, nf);
+        renf_elem_clear(a, nf);
+        renf_elem_clear(b, nf);
+        renf_elem_clear(ab, nf);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
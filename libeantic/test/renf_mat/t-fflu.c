@@ -0,0 +1,75 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 50; iter++)
+    {
+        renf_t nf;
+        renf_mat_t A, B;
+        renf_elem_t den;
+        slong m, n, i, rank, checked;
+
+        renf_randtest(nf, state,
+                2 + (slong)n_randint(state, 6),  /* length */
+                8 + (slong)n_randint(state, 64), /* prec */
+                10 + n_randint(state, 5)         /* bits */
+                );
+
+        m = 1 + (slong)n_randint(state, 4);
+        n = m + (slong)n_randint(state, 4);
+
+        renf_mat_init(A, m, n, nf);
+        renf_mat_init(B, m, n, nf);
+        renf_elem_init(den, nf);
+
+        renf_mat_randtest(A, state, 5 + n_randint(state, 10), nf);
+
+        /* A zero column does not prevent a wide matrix from having full
+         * row rank. */
+        if (n_randint(state, 2))
+            for (i = 0; i < m; i++)
+                renf_elem_zero(renf_mat_entry(A, i, 0), nf);
+
+        rank = renf_mat_fflu(B, den, NULL, A, 0, nf);
+        checked = renf_mat_fflu(B, den, NULL, A, 1, nf);
+
+        if (checked != (rank == m ? m : 0))
+        {
+            printf("FAIL:\n");
+            printf("A = \n"); renf_mat_print_pretty(A, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("rank = %ld but fflu with rank check returned %ld\n", rank, checked);
+            abort();
+        }
+
+        renf_mat_clear(A, nf);
+        renf_mat_clear(B, nf);
+        renf_elem_clear(den, nf);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
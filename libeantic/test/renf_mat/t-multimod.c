@@ -0,0 +1,118 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 50; iter++)
+    {
+        renf_t nf;
+        renf_mat_t X, Y, A, B, C1, C2;
+        renf_elem_t a, b;
+        slong m, n, r;
+
+        renf_randtest(nf, state,
+                2 + (slong)n_randint(state, 6),  /* length */
+                8 + (slong)n_randint(state, 64), /* prec */
+                10 + n_randint(state, 5)         /* bits */
+                );
+
+        m = 1 + (slong)n_randint(state, 6);
+        n = 1 + (slong)n_randint(state, 6);
+        r = (slong)n_randint(state, 7);
+
+        /* A is a product of an m×r and an r×n matrix, so its rank is at most r. */
+        renf_mat_init(X, m, r, nf);
+        renf_mat_init(Y, r, n, nf);
+        renf_mat_init(A, m, n, nf);
+        renf_mat_init(B, n, m, nf);
+        renf_mat_init(C1, m, m, nf);
+        renf_mat_init(C2, m, m, nf);
+        renf_elem_init(a, nf);
+        renf_elem_init(b, nf);
+
+        renf_mat_randtest(X, state, 5 + n_randint(state, 10), nf);
+        renf_mat_randtest(Y, state, 5 + n_randint(state, 10), nf);
+        renf_mat_randtest(B, state, 5 + n_randint(state, 10), nf);
+
+        renf_mat_mul_classical(A, X, Y, nf);
+        renf_mat_mul_multimod(C1, X, Y, nf);
+
+        if (!renf_mat_equal(A, C1, nf))
+        {
+            printf("FAIL:\n");
+            printf("X = \n"); renf_mat_print_pretty(X, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("Y = \n"); renf_mat_print_pretty(Y, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("classical and multimodular product differ\n");
+            abort();
+        }
+
+        if (renf_mat_rank_fflu(A, nf) != renf_mat_rank_multimod(A, nf))
+        {
+            printf("FAIL:\n");
+            printf("A = \n"); renf_mat_print_pretty(A, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("rank_fflu(A) = %ld, rank_multimod(A) = %ld\n", renf_mat_rank_fflu(A, nf), renf_mat_rank_multimod(A, nf));
+            abort();
+        }
+
+        renf_mat_mul_multimod(C1, A, B, nf);
+        renf_mat_mul_classical(C2, A, B, nf);
+
+        if (!renf_mat_equal(C1, C2, nf))
+        {
+            printf("FAIL:\n");
+            printf("A = \n"); renf_mat_print_pretty(A, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("B = \n"); renf_mat_print_pretty(B, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("classical and multimodular product differ\n");
+            abort();
+        }
+
+        renf_mat_det_bareiss(a, C1, nf);
+        renf_mat_det_multimod(b, C1, nf);
+
+        if (!renf_elem_equal(a, b, nf))
+        {
+            printf("FAIL:\n");
+            printf("A = \n"); renf_mat_print_pretty(C1, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("det_bareiss(A) = "); renf_elem_print_pretty(a, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("det_multimod(A) = "); renf_elem_print_pretty(b, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            abort();
+        }
+
+        renf_elem_check_embedding(b, nf, 64);
+
+        renf_mat_clear(X, nf);
+        renf_mat_clear(Y, nf);
+        renf_mat_clear(A, nf);
+        renf_mat_clear(B, nf);
+        renf_mat_clear(C1, nf);
+        renf_mat_clear(C2, nf);
+        renf_elem_clear(a, nf);
+        renf_elem_clear(b, nf);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
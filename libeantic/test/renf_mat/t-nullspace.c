@@ -0,0 +1,89 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 50; iter++)
+    {
+        renf_t nf;
+        renf_mat_t L, R, A, X, AX, E;
+        slong m, n, k, rank, nullity;
+
+        renf_randtest(nf, state,
+                2 + (slong)n_randint(state, 6),  /* length */
+                8 + (slong)n_randint(state, 64), /* prec */
+                10 + n_randint(state, 5)         /* bits */
+                );
+
+        m = (slong)n_randint(state, 7);
+        n = (slong)n_randint(state, 7);
+        k = (slong)n_randint(state, 7);
+
+        /* A random matrix of rank at most k. */
+        renf_mat_init(L, m, k, nf);
+        renf_mat_init(R, k, n, nf);
+        renf_mat_init(A, m, n, nf);
+        renf_mat_randtest(L, state, 5 + n_randint(state, 10), nf);
+        renf_mat_randtest(R, state, 5 + n_randint(state, 10), nf);
+        renf_mat_mul(A, L, R, nf);
+
+        renf_mat_init(X, n, n, nf);
+        renf_mat_init(AX, m, n, nf);
+        renf_mat_init(E, m, n, nf);
+
+        rank = renf_mat_rank(A, nf);
+        nullity = renf_mat_nullspace(X, A, nf);
+
+        if (rank > FLINT_MIN(k, FLINT_MIN(m, n)) || rank + nullity != n || rank != renf_mat_rref(E, A, nf))
+        {
+            printf("FAIL:\n");
+            printf("A = \n"); renf_mat_print_pretty(A, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("rank = %ld, nullity = %ld\n", rank, nullity);
+            abort();
+        }
+
+        renf_mat_mul(AX, A, X, nf);
+
+        if (!renf_mat_is_zero(AX, nf) || renf_mat_rank(X, nf) != nullity)
+        {
+            printf("FAIL:\n");
+            printf("A = \n"); renf_mat_print_pretty(A, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("X = \n"); renf_mat_print_pretty(X, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("X is not a basis of the kernel of A\n");
+            abort();
+        }
+
+        renf_mat_clear(L, nf);
+        renf_mat_clear(R, nf);
+        renf_mat_clear(A, nf);
+        renf_mat_clear(X, nf);
+        renf_mat_clear(AX, nf);
+        renf_mat_clear(E, nf);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_mat.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 50; iter++)
+    {
+        renf_t nf;
+        renf_mat_t L, R, A, X, B, Y, AY;
+        slong m, n, k, r;
+
+        renf_randtest(nf, state,
+                2 + (slong)n_randint(state, 6),  /* length */
+                8 + (slong)n_randint(state, 64), /* prec */
+                10 + n_randint(state, 5)         /* bits */
+                );
+
+        m = (slong)n_randint(state, 6);
+        n = (slong)n_randint(state, 6);
+        k = (slong)n_randint(state, 6);
+        r = 1 + (slong)n_randint(state, 3);
+
+        /* A random matrix of rank at most k. */
+        renf_mat_init(L, m, k, nf);
+        renf_mat_init(R, k, n, nf);
+        renf_mat_init(A, m, n, nf);
+        renf_mat_randtest(L, state, 5 + n_randint(state, 10), nf);
+        renf_mat_randtest(R, state, 5 + n_randint(state, 10), nf);
+        renf_mat_mul(A, L, R, nf);
+
+        renf_mat_init(X, n, r, nf);
+        renf_mat_init(B, m, r, nf);
+        renf_mat_init(Y, n, r, nf);
+        renf_mat_init(AY, m, r, nf);
+
+        renf_mat_randtest(X, state, 5 + n_randint(state, 10), nf);
+        renf_mat_mul(B, A, X, nf);
+
+        if (!renf_mat_solve(Y, A, B, nf))
+        {
+            printf("FAIL:\n");
+            printf("A = \n"); renf_mat_print_pretty(A, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("B = \n"); renf_mat_print_pretty(B, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("solvable system not solved\n");
+            abort();
+        }
+
+        renf_mat_mul(AY, A, Y, nf);
+
+        if (!renf_mat_equal(AY, B, nf))
+        {
+            printf("FAIL:\n");
+            printf("A = \n"); renf_mat_print_pretty(A, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("B = \n"); renf_mat_print_pretty(B, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("Y = \n"); renf_mat_print_pretty(Y, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("A Y != B\n");
+            abort();
+        }
+
+        /* Perturbing the right hand side outside of the image of A makes the
+         * system unsolvable. */
+        if (m > 0 && renf_mat_rank(A, nf) < m)
+        {
+            renf_mat_t K, At;
+            slong i, j, nullity;
+
+            /* Find a vector y with y A = 0 and y b != 0 as a witness. */
+            renf_mat_init(At, n, m, nf);
+            renf_mat_init(K, m, m, nf);
+
+            for (i = 0; i < m; i++)
+                for (j = 0; j < n; j++)
+                    renf_elem_set(renf_mat_entry(At, j, i), renf_mat_entry(A, i, j), nf);
+
+            nullity = renf_mat_nullspace(K, At, nf);
+
+            for (i = 0; i < m; i++)
+                renf_elem_add(renf_mat_entry(B, i, 0), renf_mat_entry(B, i, 0), renf_mat_entry(K, i, 0), nf);
+
+            if (nullity == 0 || renf_mat_solve(Y, A, B, nf))
+            {
+                printf("FAIL:\n");
+                printf("A = \n"); renf_mat_print_pretty(A, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+                printf("B = \n"); renf_mat_print_pretty(B, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+                printf("unsolvable system solved\n");
+                abort();
+            }
+
+            renf_mat_clear(At, nf);
+            renf_mat_clear(K, nf);
+        }
+
+        renf_mat_clear(L, nf);
+        renf_mat_clear(R, nf);
+        renf_mat_clear(A, nf);
+        renf_mat_clear(X, nf);
+        renf_mat_clear(B, nf);
+        renf_mat_clear(Y, nf);
+        renf_mat_clear(AY, nf);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
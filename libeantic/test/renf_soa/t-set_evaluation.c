@@ -0,0 +1,126 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        renf_t nf;
+        renf_soa_t v;
+        renf_elem_t a;
+        arb_t enclosure;
+        double xm, xr;
+        double * mid;
+        double * rad;
+        int * sgn;
+        slong i, len;
+
+        renf_randtest(nf, state,
+                2 + (slong)n_randint(state, 10),  /* length */
+                8 + (slong)n_randint(state, 128), /* prec */
+                10 + n_randint(state, 5)          /* bits */
+                );
+
+        /* The embedding of the field is much more precise than the double
+         * evaluation so the exact values must be contained in the double
+         * enclosures. */
+        renf_refine_embedding(nf, 256);
+
+        renf_soa_init(v, nf);
+        renf_elem_init(a, nf);
+        arb_init(enclosure);
+
+        len = (slong)n_randint(state, 300);
+
+        for (i = 0; i < len; i++)
+        {
+            renf_elem_randtest(a, state, 10 + n_randint(state, 40), nf);
+            renf_soa_push(v, a, nf);
+        }
+
+        mid = (double *) flint_malloc(FLINT_MAX(len, 1) * sizeof(double));
+        rad = (double *) flint_malloc(FLINT_MAX(len, 1) * sizeof(double));
+        sgn = (int *) flint_malloc(FLINT_MAX(len, 1) * sizeof(int));
+
+        _renf_soa_enclosure_arb(&xm, &xr, nf->emb);
+        _renf_soa_evaluate_d(mid, rad, v->num, v->den, len, v->degree, xm, xr);
+
+        for (i = 0; i < len; i++)
+        {
+            renf_soa_get_entry(a, v, i, nf);
+            renf_elem_set_evaluation(a, nf, 256);
+
+            if (!isfinite(rad[i]))
+            {
+                printf("FAIL:\n");
+                printf("a = "); renf_elem_print_pretty(a, "x", nf, 10, EANTIC_STR_ALG | EANTIC_STR_D); printf("\n");
+                printf("no finite enclosure found\n");
+                abort();
+            }
+
+            arb_set_d(enclosure, mid[i]);
+            mag_set_d(arb_radref(enclosure), rad[i]);
+
+            if (!arb_contains(enclosure, a->emb))
+            {
+                printf("FAIL:\n");
+                printf("a = "); renf_elem_print_pretty(a, "x", nf, 10, EANTIC_STR_ALG | EANTIC_STR_D); printf("\n");
+                printf("enclosure = "); arb_printd(enclosure, 20); printf("\n");
+                printf("embedding = "); arb_printd(a->emb, 20); printf("\n");
+                abort();
+            }
+        }
+
+        renf_soa_set_evaluation(v, nf);
+        renf_soa_sgn(sgn, v, nf);
+
+        for (i = 0; i < len; i++)
+        {
+            renf_soa_get_entry(a, v, i, nf);
+
+            if (sgn[i] != renf_elem_sgn(a, nf))
+            {
+                printf("FAIL:\n");
+                printf("a = "); renf_elem_print_pretty(a, "x", nf, 10, EANTIC_STR_ALG | EANTIC_STR_D); printf("\n");
+                printf("got sgn(a) = %d\n", sgn[i]);
+                abort();
+            }
+        }
+
+        flint_free(mid);
+        flint_free(rad);
+        flint_free(sgn);
+
+        arb_clear(enclosure);
+        renf_elem_clear(a, nf);
+        renf_soa_clear(v);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
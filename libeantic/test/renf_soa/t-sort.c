@@ -0,0 +1,144 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_soa.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        renf_t nf;
+        renf_soa_t v;
+        renf_elem_t a, b;
+        fmpq_t x;
+        slong i, len, min, max;
+        slong * perm;
+        int * sgn;
+
+        renf_randtest(nf, state,
+                2 + (slong)n_randint(state, 8),   /* length */
+                8 + (slong)n_randint(state, 128), /* prec */
+                10 + n_randint(state, 5)          /* bits */
+                );
+
+        renf_soa_init(v, nf);
+        renf_elem_init(a, nf);
+        renf_elem_init(b, nf);
+        fmpq_init(x);
+
+        len = (slong)n_randint(state, 50);
+
+        /* Random elements, some of them repeated and some of them very close
+         * to each other so that the enclosures do not suffice to sort. */
+        for (i = 0; i < len; i++)
+        {
+            const ulong kind = i == 0 ? 2 : n_randint(state, 4);
+
+            if (kind < 2)
+            {
+                renf_soa_get_entry(a, v, (slong)n_randint(state, (ulong)i), nf);
+
+                if (kind == 1)
+                {
+                    fmpq_one(x);
+                    fmpz_mul_2exp(fmpq_denref(x), fmpq_denref(x), 60 + n_randint(state, 100));
+                    renf_elem_add_fmpq(a, a, x, nf);
+                }
+            }
+            else
+            {
+                renf_elem_randtest(a, state, 10 + n_randint(state, 30), nf);
+            }
+
+            renf_soa_push(v, a, nf);
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            renf_soa_get_entry(b, v, i, nf);
+            renf_elem_check_embedding(b, nf, 64);
+        }
+
+        perm = (slong *) flint_malloc(FLINT_MAX(len, 1) * sizeof(slong));
+        sgn = (int *) flint_malloc(FLINT_MAX(len, 1) * sizeof(int));
+
+        renf_soa_sort(perm, v, nf);
+
+        for (i = 1; i < len; i++)
+        {
+            int c;
+
+            renf_soa_get_entry(a, v, perm[i - 1], nf);
+            renf_soa_get_entry(b, v, perm[i], nf);
+
+            c = renf_elem_cmp(a, b, nf);
+
+            if (c > 0 || (c == 0 && perm[i - 1] > perm[i]))
+            {
+                printf("FAIL:\n");
+                printf("a = "); renf_elem_print_pretty(a, "x", nf, 10, EANTIC_STR_ALG | EANTIC_STR_D); printf("\n");
+                printf("b = "); renf_elem_print_pretty(b, "x", nf, 10, EANTIC_STR_ALG | EANTIC_STR_D); printf("\n");
+                printf("elements at positions %ld and %ld are not sorted\n", perm[i - 1], perm[i]);
+                abort();
+            }
+        }
+
+        min = renf_soa_min(v, nf);
+        max = renf_soa_max(v, nf);
+
+        if (len == 0 ? (min != -1 || max != -1) : (renf_soa_cmp(v, min, perm[0], nf) != 0 || renf_soa_cmp(v, max, perm[len - 1], nf) != 0))
+        {
+            printf("FAIL:\n");
+            printf("renf_soa_min or renf_soa_max did not find an extremal element\n");
+            abort();
+        }
+
+        renf_soa_sgn(sgn, v, nf);
+
+        for (i = 0; i < len; i++)
+        {
+            renf_soa_get_entry(a, v, i, nf);
+
+            if (sgn[i] != renf_elem_sgn(a, nf))
+            {
+                printf("FAIL:\n");
+                printf("a = "); renf_elem_print_pretty(a, "x", nf, 10, EANTIC_STR_ALG | EANTIC_STR_D); printf("\n");
+                printf("got sgn(a) = %d\n", sgn[i]);
+                abort();
+            }
+        }
+
+        flint_free(perm);
+        flint_free(sgn);
+
+        fmpq_clear(x);
+        renf_elem_clear(a, nf);
+        renf_elem_clear(b, nf);
+        renf_soa_clear(v);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
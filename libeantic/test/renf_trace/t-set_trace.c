@@ -0,0 +1,171 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf.h"
+#include "../../e-antic/renf_elem.h"
+#include "../../e-antic/renf_trace.h"
+#include "../../e-antic/fmpq_poly_extra.h"
+
+typedef struct
+{
+    slong events[RENF_TRACE_DESERIALIZATION + 1];
+    int consistent;
+} trace_counts;
+
+static void count(const renf_trace_event * event, void * data)
+{
+    trace_counts * counts = (trace_counts *) data;
+
+    counts->events[event->kind]++;
+
+    if (event->nf == NULL || event->start == 0)
+        counts->consistent = 0;
+
+    if (event->kind == RENF_TRACE_REFINE_EMBEDDING && event->prec_after < event->prec_before)
+        counts->consistent = 0;
+}
+
+int main(void)
+{
+    renf_t nf;
+    renf_elem_t a, b;
+    fmpq_poly_t p;
+    fmpq_t eps;
+    arb_t emb;
+    trace_counts counts;
+    void * data;
+    slong i;
+    FILE * file;
+    int c;
+
+    FLINT_TEST_INIT(state);
+
+    for (i = 0; i <= RENF_TRACE_DESERIALIZATION; i++)
+        counts.events[i] = 0;
+    counts.consistent = 1;
+
+    renf_set_trace(count, &counts);
+    if (renf_get_trace(&data) != count || data != &counts)
+    {
+        printf("FAIL:\n");
+        printf("callback not installed\n");
+        fflush(stdout);
+        abort();
+    }
+
+    fmpq_poly_init(p);
+    fmpq_poly_set_str_pretty(p, "x^3 - 2", "x");
+    arb_init(emb);
+    arb_set_d(emb, 1.26);
+    mag_set_d(arb_radref(emb), 0.1);
+    renf_init(nf, p, emb, 32);
+
+    renf_elem_init(a, nf);
+    renf_elem_init(b, nf);
+    fmpq_init(eps);
+    fmpq_set_si(eps, 1, 1);
+    fmpz_mul_2exp(fmpq_denref(eps), fmpq_denref(eps), 200);
+
+    /* a comparison that needs more precise enclosures */
+    renf_elem_gen(a, nf);
+    renf_elem_add_fmpq(b, a, eps, nf);
+    if (renf_elem_cmp(a, b, nf) != -1)
+    {
+        printf("FAIL:\n");
+        printf("wrong comparison\n");
+        fflush(stdout);
+        abort();
+    }
+
+    renf_set_trace(NULL, NULL);
+
+    if (counts.events[RENF_TRACE_CONSTRUCTION] != 1 || counts.events[RENF_TRACE_REFINE_EMBEDDING] == 0 || counts.events[RENF_TRACE_ESCALATION] == 0 || !counts.consistent)
+    {
+        printf("FAIL:\n");
+        printf("unexpected events\n");
+        printf("construction = %ld, refine_embedding = %ld, escalation = %ld\n",
+            counts.events[RENF_TRACE_CONSTRUCTION],
+            counts.events[RENF_TRACE_REFINE_EMBEDDING],
+            counts.events[RENF_TRACE_ESCALATION]);
+        fflush(stdout);
+        abort();
+    }
+
+    /* no events are reported once tracing is disabled */
+    i = counts.events[RENF_TRACE_REFINE_EMBEDDING];
+    renf_refine_embedding(nf, 512);
+    if (counts.events[RENF_TRACE_REFINE_EMBEDDING] != i)
+    {
+        printf("FAIL:\n");
+        printf("event reported after tracing has been disabled\n");
+        fflush(stdout);
+        abort();
+    }
+
+    /* the Chrome backend writes a JSON array of events */
+    if (!renf_trace_chrome_open("t-set_trace.json"))
+    {
+        printf("FAIL:\n");
+        printf("could not open trace file\n");
+        fflush(stdout);
+        abort();
+    }
+    renf_refine_embedding(nf, 1024);
+    renf_trace_chrome_close();
+
+    if (renf_get_trace(NULL) != NULL)
+    {
+        printf("FAIL:\n");
+        printf("Chrome trace not uninstalled\n");
+        fflush(stdout);
+        abort();
+    }
+
+    file = fopen("t-set_trace.json", "r");
+    if (file == NULL || fgetc(file) != '[' || fgetc(file) != '\n' || fgetc(file) != '{')
+    {
+        printf("FAIL:\n");
+        printf("malformed trace file\n");
+        fflush(stdout);
+        abort();
+    }
+    while ((c = fgetc(file)) != EOF && c != ']');
+    if (c != ']')
+    {
+        printf("FAIL:\n");
+        printf("trace file not terminated\n");
+        fflush(stdout);
+        abort();
+    }
+    fclose(file);
+    remove("t-set_trace.json");
+
+    renf_elem_clear(a, nf);
+    renf_elem_clear(b, nf);
+    fmpq_clear(eps);
+    arb_clear(emb);
+    fmpq_poly_clear(p);
+    renf_clear(nf);
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
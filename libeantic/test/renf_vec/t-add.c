@@ -0,0 +1,145 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        renf_t nf;
+        renf_vec_t u, v, w, p;
+        renf_elem_t a, b, t;
+        fmpq_t c;
+        slong i, n;
+
+        renf_randtest(nf, state,
+                2 + (slong)n_randint(state, 6),  /* length */
+                8 + (slong)n_randint(state, 64), /* prec */
+                10 + n_randint(state, 5)         /* bits */
+                );
+
+        n = 1 + (slong)n_randint(state, 10);
+
+        renf_vec_init(u, n, nf);
+        renf_vec_init(v, n, nf);
+        renf_vec_init(w, n, nf);
+        renf_vec_init(p, n, nf);
+        renf_elem_init(a, nf);
+        renf_elem_init(b, nf);
+        renf_elem_init(t, nf);
+        fmpq_init(c);
+
+        for (i = 0; i < n; i++)
+        {
+            renf_elem_randtest(a, state, 10 + n_randint(state, 30), nf);
+            renf_vec_set_entry(u, i, a, nf);
+            renf_elem_randtest(a, state, 10 + n_randint(state, 30), nf);
+            renf_vec_set_entry(v, i, a, nf);
+        }
+
+        /* (u + v) - v = u, also when the output aliases an input. */
+        renf_vec_add(w, u, v);
+        renf_vec_sub(w, w, v);
+        if (!renf_vec_equal(w, u))
+        {
+            printf("FAIL:\n");
+            printf("(u + v) - v != u\n");
+            abort();
+        }
+
+        renf_vec_set(w, v);
+        renf_vec_add(w, u, w);
+        renf_vec_sub(w, u, w);
+        renf_vec_neg(w, w);
+        if (!renf_vec_equal(w, v))
+        {
+            printf("FAIL:\n");
+            printf("-(u - (u + v)) != v\n");
+            abort();
+        }
+
+        /* a * v does not change when the output aliases the input. */
+        renf_elem_randtest(a, state, 10 + n_randint(state, 30), nf);
+        renf_vec_scalar_mul(p, v, a, nf);
+        renf_vec_set(w, v);
+        renf_vec_scalar_mul(w, w, a, nf);
+        if (!renf_vec_equal(w, p))
+        {
+            printf("FAIL:\n");
+            printf("a * v differs when computed in place\n");
+            abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            renf_vec_get_entry(a, u, i, nf);
+            renf_vec_get_entry(b, v, i, nf);
+            renf_elem_add(a, a, b, nf);
+
+            renf_vec_add(w, u, v);
+            renf_vec_get_entry(t, w, i, nf);
+
+            if (!renf_elem_equal(a, t, nf))
+            {
+                printf("FAIL:\n");
+                printf("entries of u + v are not the sums of the entries\n");
+                abort();
+            }
+        }
+
+        renf_vec_sub(w, u, u);
+        if (!renf_vec_is_zero(w))
+        {
+            printf("FAIL:\n");
+            printf("u - u != 0\n");
+            abort();
+        }
+
+        /* The primitive part only depends on the ray spanned by u. */
+        fmpq_randtest_not_zero(c, state, 20);
+        fmpq_abs(c, c);
+        renf_vec_scalar_mul_fmpq(w, u, c);
+        renf_vec_primitive_part(w, w);
+        renf_vec_primitive_part(p, u);
+        if (!renf_vec_equal(w, p))
+        {
+            printf("FAIL:\n");
+            printf("primitive part of a positive multiple of u differs from the primitive part of u\n");
+            abort();
+        }
+
+        renf_vec_clear(u);
+        renf_vec_clear(v);
+        renf_vec_clear(w);
+        renf_vec_clear(p);
+        renf_elem_clear(a, nf);
+        renf_elem_clear(b, nf);
+        renf_elem_clear(t, nf);
+        fmpq_clear(c);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_vec.h"
+
+int main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        renf_t nf;
+        renf_vec_t u, v, w;
+        renf_elem * a;
+        renf_elem * b;
+        renf_elem_t c, dot, t;
+        slong i, n;
+
+        renf_randtest(nf, state,
+                2 + (slong)n_randint(state, 6),  /* length */
+                8 + (slong)n_randint(state, 64), /* prec */
+                10 + n_randint(state, 5)         /* bits */
+                );
+
+        n = (slong)n_randint(state, 10);
+
+        a = (renf_elem *) flint_malloc(FLINT_MAX(n, 1) * sizeof(renf_elem));
+        b = (renf_elem *) flint_malloc(FLINT_MAX(n, 1) * sizeof(renf_elem));
+
+        renf_vec_init(u, n, nf);
+        renf_vec_init(v, n, nf);
+        renf_vec_init(w, n, nf);
+        renf_elem_init(c, nf);
+        renf_elem_init(dot, nf);
+        renf_elem_init(t, nf);
+
+        renf_elem_zero(dot, nf);
+
+        for (i = 0; i < n; i++)
+        {
+            renf_elem_init(a + i, nf);
+            renf_elem_init(b + i, nf);
+            renf_elem_randtest(a + i, state, 10 + n_randint(state, 30), nf);
+            renf_elem_randtest(b + i, state, 10 + n_randint(state, 30), nf);
+
+            renf_vec_set_entry(u, i, a + i, nf);
+            renf_vec_set_entry(v, i, b + i, nf);
+
+            renf_elem_mul(t, a + i, b + i, nf);
+            renf_elem_add(dot, dot, t, nf);
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            renf_vec_get_entry(t, u, i, nf);
+            if (!renf_elem_equal(t, a + i, nf))
+            {
+                printf("FAIL:\n");
+                printf("a = "); renf_elem_print_pretty(a + i, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+                printf("entry = "); renf_elem_print_pretty(t, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+                printf("entry has not been preserved\n");
+                abort();
+            }
+            renf_elem_check_embedding(t, nf, 64);
+        }
+
+        renf_vec_dot(t, u, v, nf);
+
+        if (!renf_elem_equal(t, dot, nf))
+        {
+            printf("FAIL:\n");
+            printf("dot = "); renf_elem_print_pretty(dot, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("renf_vec_dot = "); renf_elem_print_pretty(t, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            abort();
+        }
+
+        renf_elem_check_embedding(t, nf, 64);
+
+        /* The dot product is linear in the first argument. */
+        renf_elem_randtest(c, state, 10 + n_randint(state, 30), nf);
+        renf_vec_scalar_mul(w, u, c, nf);
+        renf_vec_dot(t, w, v, nf);
+        renf_elem_mul(dot, dot, c, nf);
+
+        if (!renf_elem_equal(t, dot, nf))
+        {
+            printf("FAIL:\n");
+            printf("c = "); renf_elem_print_pretty(c, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("c * dot = "); renf_elem_print_pretty(dot, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            printf("dot(c * u, v) = "); renf_elem_print_pretty(t, "x", nf, 10, EANTIC_STR_ALG); printf("\n");
+            abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            renf_elem_clear(a + i, nf);
+            renf_elem_clear(b + i, nf);
+        }
+        flint_free(a);
+        flint_free(b);
+
+        renf_vec_clear(u);
+        renf_vec_clear(v);
+        renf_vec_clear(w);
+        renf_elem_clear(c, nf);
+        renf_elem_clear(dot, nf);
+        renf_elem_clear(t, nf);
+        renf_clear(nf);
+    }
+
+#ifdef FLINT_TEST_CLEAR
+    FLINT_TEST_CLEAR(state)
+#else
+    // FLINT <3.2.2 calls this macro FLINT_TEST_CLEAR instead of FLINT_TEST_CLEANUP
+    FLINT_TEST_CLEANUP(state)
+#endif
+
+    return 0;
+}
@@ -412,3 +412,95 @@ TEST_CASE("Incompatible parents cannot be mixed", "[renf_elem][parents]")
         REQUIRE((a / b * b) == a);
     }
 }
+
+TEST_CASE("Registered embeddings are used to mix parents", "[renf_elem][parents]")
+{
+    auto K = renf_class::make("x^2 - 2", "x", "1.4 +/- 0.1");
+    auto L = renf_class::make("y^4 - 2", "y", "1.19 +/- 0.01");
+
+    const auto y = L->gen();
+
+    REQUIRE_THROWS(K->register_embedding(y));
+    REQUIRE_THROWS(K->register_embedding(-y * y));
+    REQUIRE(!K->has_embedding(*L));
+
+    K->register_embedding(y * y);
+
+    REQUIRE(K->has_embedding(*L));
+    REQUIRE(!L->has_embedding(*K));
+
+    REQUIRE(renf_elem_class(*L, K->gen()) == y * y);
+    REQUIRE(renf_elem_class(*L, K->gen() / 3 + 1) == y * y / 3 + 1);
+
+    SECTION("Element of the larger field on the left")
+    {
+        auto a = y + K->gen();
+        REQUIRE(a.parent() == *L);
+        REQUIRE(a == y + y * y);
+
+        a *= K->gen();
+        REQUIRE(a == (y + y * y) * y * y);
+    }
+
+    SECTION("Element of the smaller field on the left")
+    {
+        auto a = K->gen() - y;
+        REQUIRE(a.parent() == *L);
+        REQUIRE(a == y * y - y);
+    }
+}
+
+TEST_CASE("Registered embeddings do not keep fields alive", "[renf_elem][parents]")
+{
+    auto K = renf_class::make("x^2 - 2", "x", "1.4 +/- 0.1");
+    auto L = renf_class::make("y^2 - 2", "y", "1.4 +/- 0.1");
+
+    K->register_embedding(L->gen());
+    L->register_embedding(K->gen());
+
+    REQUIRE(K->has_embedding(*L));
+    REQUIRE(L->has_embedding(*K));
+
+    L.reset();
+
+    auto M = renf_class::make("y^2 - 2", "y", "1.4 +/- 0.1");
+    REQUIRE(!K->has_embedding(*M));
+    REQUIRE(!M->has_embedding(*K));
+}
+
+TEST_CASE("Policy for arithmetic with mixed parents", "[renf_elem][parents]")
+{
+    auto K = renf_class::make("x^2 - 2", "x", "1.4 +/- 0.1");
+    auto L = renf_class::make("x^2 - 3", "x", "1.7 +/- 0.1");
+
+    // Restore the global policy even if a REQUIRE below fails.
+    struct policy_guard
+    {
+        ~policy_guard() { renf_elem_class::set_mixed_parents(policy); }
+        const renf_elem_class::mixed_parents policy = renf_elem_class::get_mixed_parents();
+    } guard;
+
+    SECTION("Operations are counted")
+    {
+        renf_elem_class::set_mixed_parents(renf_elem_class::mixed_parents::allow);
+
+        const auto count = renf_elem_class::mixed_parents_count();
+
+        REQUIRE(K->gen() + L->one() == K->gen() + 1);
+        REQUIRE(renf_elem_class::mixed_parents_count() == count + 1);
+
+        // Arithmetic with the rational field is not deprecated.
+        REQUIRE(K->gen() + renf_elem_class(1) == K->gen() + 1);
+        REQUIRE(renf_elem_class::mixed_parents_count() == count + 1);
+    }
+
+    SECTION("Operations can be rejected")
+    {
+        renf_elem_class::set_mixed_parents(renf_elem_class::mixed_parents::raise);
+
+        const auto count = renf_elem_class::mixed_parents_count();
+
+        REQUIRE_THROWS_AS(K->gen() + L->one(), std::invalid_argument);
+        REQUIRE(renf_elem_class::mixed_parents_count() == count + 1);
+    }
+}
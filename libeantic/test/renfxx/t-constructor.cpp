@@ -12,6 +12,7 @@
 
 #include <limits>
 #include <set>
+#include <stdexcept>
 
 #include "../../e-antic/config.h"
 
@@ -195,3 +196,15 @@ TEST_CASE("Construct trivial field", "[renf_class]")
 
     REQUIRE(K.degree() == 1);
 }
+
+TEST_CASE("Construct field from invalid input", "[renf_class]")
+{
+    // Nothing must leak when the construction fails at any stage.
+    REQUIRE_THROWS_AS(renf_class::make("a*a - 2", "a", "1.4 +/- 0.1", 64), std::invalid_argument);
+    REQUIRE_THROWS_AS(renf_class::make("a^2 - 2", "a", "one", 64), std::invalid_argument);
+    REQUIRE_THROWS_AS(renf_class::make("a^2 - 2", "a", "0 +/- 2", 64), std::invalid_argument);
+    REQUIRE_THROWS_AS(renf_class::make("a^2 - 2", "a", [](slong) -> std::string { throw std::runtime_error("no embedding"); }, 64), std::runtime_error);
+
+    auto K = renf_class::make("a^2 - 2", "a", "1.4 +/- 0.1", 64);
+    REQUIRE(K->degree() == 2);
+}
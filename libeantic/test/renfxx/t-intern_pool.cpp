@@ -0,0 +1,120 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <vector>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_elem_intern_pool.hpp"
+
+#include "../rand_generator.hpp"
+#include "../renf_class_generator.hpp"
+#include "../renf_elem_class_generator.hpp"
+
+#include "../external/catch2/single_include/catch2/catch.hpp"
+
+using namespace eantic;
+
+TEST_CASE("Interning of renf_elem_class", "[renf_elem_intern_pool]")
+{
+    flint_rand_t& state = GENERATE(rands());
+    const auto& K = GENERATE_REF(take(16, renf_classs(state)));
+
+    CAPTURE(K);
+
+    renf_elem_intern_pool pool(K);
+
+    SECTION("Handles are equal if and only if elements are equal")
+    {
+        std::vector<renf_elem_class> elements;
+        std::vector<renf_elem_intern_pool::handle> handles;
+
+        for (int i = 0; i < 16; i++)
+        {
+            renf_elem_class a(K);
+            renf_elem_randtest(a.renf_elem_t(), state, 2 + n_randint(state, 8), K.renf_t());
+
+            elements.push_back(a);
+            handles.push_back(pool.intern(a));
+
+            // Intern an element that is equal to a but computed independently.
+            elements.push_back((a + K.gen()) - K.gen());
+            handles.push_back(pool.intern(elements.back()));
+        }
+
+        for (size_t i = 0; i < elements.size(); i++)
+        {
+            REQUIRE(pool[handles[i]] == elements[i]);
+            for (size_t j = 0; j < elements.size(); j++)
+                REQUIRE((handles[i] == handles[j]) == (elements[i] == elements[j]));
+        }
+
+        REQUIRE(pool.size() <= elements.size() / 2);
+        REQUIRE(pool.references(handles[0]) >= 2);
+    }
+
+    SECTION("Rationals are interned into the field")
+    {
+        const auto h = pool.intern(renf_elem_class(mpq_class(1, 3)));
+        REQUIRE(h == pool.intern(renf_elem_class(K, mpq_class(1, 3))));
+        REQUIRE(pool[h].parent() == K);
+        REQUIRE(pool.references(h) == 2);
+    }
+
+    SECTION("Canonical elements are shared")
+    {
+        const auto a = pool.intern(K.gen());
+        const auto b = pool.intern(K.gen() * 1);
+        REQUIRE(&pool[a] == &pool[b]);
+    }
+
+    SECTION("Lookups do not add elements")
+    {
+        renf_elem_intern_pool::handle h;
+        REQUIRE(!pool.find(K.gen(), h));
+        REQUIRE(pool.size() == 0);
+
+        const auto g = pool.intern(K.gen());
+        REQUIRE(pool.find(K.gen(), h));
+        REQUIRE(h == g);
+        REQUIRE(pool.references(g) == 1);
+    }
+
+    SECTION("Unreferenced elements can be evicted")
+    {
+        const auto zero = pool.intern(K.zero());
+        const auto one = pool.intern(K.one());
+
+        pool.release(one);
+        REQUIRE(pool.size() == 2);
+        REQUIRE(pool.evict() == 1);
+        REQUIRE(pool.size() == 1);
+        REQUIRE(pool[zero] == K.zero());
+
+        renf_elem_intern_pool::handle h;
+        REQUIRE(!pool.find(K.one(), h));
+
+        // Handles of evicted elements are reused.
+        REQUIRE(pool.intern(K.one()) == one);
+    }
+
+    SECTION("Unreferenced elements are evicted automatically if requested")
+    {
+        renf_elem_intern_pool evicting(K, true);
+
+        const auto g = evicting.intern(K.gen());
+        evicting.retain(g);
+        evicting.release(g);
+        REQUIRE(evicting.size() == 1);
+        evicting.release(g);
+        REQUIRE(evicting.size() == 0);
+    }
+}
@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2026 Julian Rüth
+
+    This file is part of e-antic
+
+    e-antic is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3.0 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <sstream>
+#include <stdexcept>
+
+#include "../../e-antic/config.h"
+
+#include "../../e-antic/renf_matrix.hpp"
+
+#include "../rand_generator.hpp"
+#include "../renf_class_generator.hpp"
+
+#include "../external/catch2/single_include/catch2/catch.hpp"
+
+using namespace eantic;
+
+namespace {
+
+renf_matrix random_matrix(const renf_class& K, flint_rand_t& state, size_t rows, size_t cols)
+{
+    renf_matrix A(K, rows, cols);
+    renf_mat_randtest(A.renf_mat_t(), state, 2 + n_randint(state, 8), K.renf_t());
+    return A;
+}
+
+}
+
+TEST_CASE("Linear Algebra with renf_matrix", "[renf_matrix]")
+{
+    flint_rand_t& state = GENERATE(rands());
+    const auto& K = GENERATE_REF(take(8, renf_classs(state)));
+
+    CAPTURE(K);
+
+    SECTION("Entries can be read and written")
+    {
+        renf_matrix A(K, 2, 3);
+        A.set(1, 2, K.gen());
+        A.set(0, 0, 1);
+
+        REQUIRE(A(1, 2) == K.gen());
+        REQUIRE(A(0, 0) == 1);
+        REQUIRE(A(0, 1) == 0);
+        REQUIRE(A(0, 0).parent() == K);
+
+        REQUIRE_THROWS_AS(A(2, 0), std::out_of_range);
+        REQUIRE_THROWS_AS(renf_matrix(K, {{1, 2}, {3}}), std::invalid_argument);
+    }
+
+    SECTION("Multiplication with the identity")
+    {
+        const auto A = random_matrix(K, state, 3, 4);
+
+        REQUIRE(renf_matrix::identity(K, 3) * A == A);
+        REQUIRE(A * renf_matrix::identity(K, 4) == A);
+    }
+
+    SECTION("Determinants are multiplicative")
+    {
+        const auto A = random_matrix(K, state, 4, 4);
+        const auto B = random_matrix(K, state, 4, 4);
+
+        REQUIRE((A * B).det() == A.det() * B.det());
+        REQUIRE_THROWS_AS(random_matrix(K, state, 2, 3).det(), std::invalid_argument);
+    }
+
+    SECTION("Rank and Kernel")
+    {
+        const auto A = random_matrix(K, state, 4, 2) * random_matrix(K, state, 2, 5);
+        const auto kernel = A.kernel();
+
+        REQUIRE(A.rank() <= 2);
+        REQUIRE(kernel.rows() == 5);
+        REQUIRE(kernel.cols() == 5 - A.rank());
+        REQUIRE(A * kernel == renf_matrix(K, 4, kernel.cols()));
+        REQUIRE(kernel.rank() == kernel.cols());
+    }
+
+    SECTION("Solving Linear Systems")
+    {
+        const auto A = random_matrix(K, state, 3, 3);
+        const auto b = A * random_matrix(K, state, 3, 1);
+
+        REQUIRE(A * A.solve(b) == b);
+
+        const auto singular = renf_matrix(K, {{1, 2}, {2, 4}});
+        REQUIRE_THROWS_AS(singular.solve(renf_matrix(K, {{1}, {0}})), std::invalid_argument);
+    }
+
+    SECTION("Printing")
+    {
+        std::stringstream s;
+        s << renf_matrix(K, {{1, 2}, {3, 4}});
+        REQUIRE(s.str() == "[1, 2]\n[3, 4]");
+    }
+}